@@ -115,13 +115,14 @@ namespace cppwinrt
         }
     }
 
-    static void write_parent_depends(writer& w, cache const& c, std::string_view const& type_namespace)
+    // Returns the namespace whose header was included, if any.
+    static std::string_view write_parent_depends(writer& w, cache const& c, std::string_view const& type_namespace)
     {
         auto pos = type_namespace.rfind('.');
 
         if (pos == std::string::npos)
         {
-            return;
+            return {};
         }
 
         auto parent = type_namespace.substr(0, pos);
@@ -130,10 +131,11 @@ namespace cppwinrt
         if (found != c.namespaces().end() && has_projected_types(found->second))
         {
             w.write_root_include(parent);
+            return parent;
         }
         else
         {
-            write_parent_depends(w, c, parent);
+            return write_parent_depends(w, c, parent);
         }
     }
 
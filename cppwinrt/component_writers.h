@@ -92,46 +92,240 @@ namespace cppwinrt
         }
     }
 
-    static void write_component_activation(writer& w, TypeDef const& type)
+    static void write_component_activation(writer& w, std::pair<TypeDef, uint32_t> const& activatable)
     {
-        if (!has_factory_members(w, type) || is_always_disabled(type))
-        {
-            return;
-        }
-
+        auto&& [type, index] = activatable;
         auto type_name = type.TypeName();
         auto type_namespace = type.TypeNamespace();
         auto impl_name = get_impl_name(type_namespace, type_name);
 
+        w.write(R"(        if (requal(name, L"%.%"))
+        {
+)",
+            type_namespace,
+            type_name);
+
+        if (settings.component_activation_stats)
+        {
+            w.write("            return record_activation(activation_statistics[%], [] { return ", index);
+        }
+        else
+        {
+            w.write("            return ");
+        }
+
         if (settings.component_opt)
         {
-            auto format = R"(
-    if (requal(name, L"%.%"))
+            w.write("winrt_make_%()", impl_name);
+        }
+        else
+        {
+            w.write("winrt::detach_abi(winrt::make<winrt::@::factory_implementation::%>())",
+                type_namespace,
+                type_name);
+        }
+
+        if (settings.component_activation_stats)
+        {
+            w.write("; })");
+        }
+
+        w.write(R"(;
+        }
+)");
+    }
+
+    // Classes are numbered in the order they are passed to the writer.
+    static std::vector<std::pair<TypeDef, uint32_t>> get_activatable_classes(writer& w, std::vector<TypeDef> const& classes)
     {
-        return winrt_make_%();
+        std::vector<std::pair<TypeDef, uint32_t>> result;
+
+        for (auto&& type : classes)
+        {
+            if (has_factory_members(w, type) && !is_always_disabled(type))
+            {
+                result.emplace_back(type, static_cast<uint32_t>(result.size()));
+            }
+        }
+
+        return result;
+    }
+
+    // With -activation_stats each class counts the factories it hands out and the time spent creating them.
+    static void write_component_activation_statistics(writer& w, std::vector<TypeDef> const& classes)
+    {
+        if (!settings.component_activation_stats)
+        {
+            return;
+        }
+
+        auto activatable = get_activatable_classes(w, classes);
+
+        w.write(R"(
+namespace
+{
+    struct activation_statistic
+    {
+        std::wstring_view const name;
+        std::atomic<uint64_t> count{};
+        std::atomic<uint64_t> nanoseconds{};
+    };
+
+    activation_statistic activation_statistics[]
+    {
+)");
+
+        for (auto&& [type, index] : activatable)
+        {
+            w.write("        { L\"%.%\" }, // %\n", type.TypeNamespace(), type.TypeName(), index);
+        }
+
+        if (activatable.empty())
+        {
+            w.write("        { {} },\n");
+        }
+
+        auto format = R"(    };
+
+    template <typename Make>
+    void* record_activation(activation_statistic& statistic, Make&& make)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        void* const factory = make();
+        auto const elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        statistic.count.fetch_add(1, std::memory_order_relaxed);
+        statistic.nanoseconds.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+        return factory;
     }
+}
+
+void __stdcall %_get_activation_statistics(void* context, void(__stdcall* callback)(void* context, std::wstring_view const& name, uint64_t count, uint64_t nanoseconds)) noexcept
+{
+    for (auto&& statistic : activation_statistics)
+    {
+        if (!statistic.name.empty())
+        {
+            callback(context, statistic.name, statistic.count.load(std::memory_order_relaxed), statistic.nanoseconds.load(std::memory_order_relaxed));
+        }
+    }
+}
 )";
 
-            w.write(format,
-                type_namespace,
-                type_name,
-                impl_name);
+        w.write(format, settings.component_lib);
+    }
+
+    // Generated activation switches on the FNV-1a hash of the class name's UTF-16 code units.
+    static std::optional<uint32_t> get_activation_hash(TypeDef const& type)
+    {
+        uint32_t result = 2166136261;
+
+        auto hash = [&](std::string_view const& value)
+        {
+            for (auto c : value)
+            {
+                if (static_cast<uint8_t>(c) >= 0x80)
+                {
+                    return false;
+                }
+
+                result = (result ^ static_cast<uint8_t>(c)) * 16777619;
+            }
+
+            return true;
+        };
+
+        if (hash(type.TypeNamespace()) && hash(".") && hash(type.TypeName()))
+        {
+            return result;
         }
-        else
+
+        return {};
+    }
+
+    static void write_component_activations(writer& w, std::vector<TypeDef> const& classes)
+    {
+        std::map<uint32_t, std::vector<std::pair<TypeDef, uint32_t>>> buckets;
+        std::vector<std::pair<TypeDef, uint32_t>> unhashed;
+
+        for (auto&& activatable : get_activatable_classes(w, classes))
+        {
+            if (auto hash = get_activation_hash(activatable.first))
+            {
+                buckets[*hash].push_back(activatable);
+            }
+            else
+            {
+                unhashed.push_back(activatable);
+            }
+        }
+
+        if (!buckets.empty())
         {
             auto format = R"(
-    if (requal(name, L"%.%"))
+    auto hash = [](std::wstring_view const& value) noexcept
+    {
+        uint32_t result = 2166136261;
+
+        for (wchar_t const c : value)
+        {
+            result = (result ^ c) * 16777619;
+        }
+
+        return result;
+    };
+
+    switch (hash(name))
     {
-        return winrt::detach_abi(winrt::make<winrt::@::factory_implementation::%>());
+)";
+
+            w.write(format);
+
+            for (auto&& [hash, types] : buckets)
+            {
+                w.write_printf("    case 0x%08X:\n", hash);
+                w.write_each<write_component_activation>(types);
+                w.write("        break;\n");
+            }
+
+            w.write("    }\n");
+        }
+
+        if (!unhashed.empty())
+        {
+            w.write("\n    {\n");
+            w.write_each<write_component_activation>(unhashed);
+            w.write("    }\n");
+        }
     }
+
+    // With -activation_registry a statically linked component can register its classes with its caller.
+    static void write_component_registrations(writer& w, std::vector<TypeDef> const& classes)
+    {
+        if (!settings.component_activation_registry)
+        {
+            return;
+        }
+
+        w.write(R"(
+void __stdcall %_register_activation_factories()
+{
+)", settings.component_lib);
+
+        for (auto&& activatable : get_activatable_classes(w, classes))
+        {
+            auto&& type = activatable.first;
+            auto format = R"(    winrt::register_activation_factory(L"%.%", [] { return %_get_activation_factory(L"%.%"); });
 )";
 
             w.write(format,
-                type_namespace,
-                type_name,
-                type_namespace,
-                type_name);
+                type.TypeNamespace(),
+                type.TypeName(),
+                settings.component_lib,
+                type.TypeNamespace(),
+                type.TypeName());
         }
+
+        w.write("}\n");
     }
 
     static void write_module_g_cpp(writer& w, std::vector<TypeDef> const& classes)
@@ -148,7 +342,7 @@ bool __stdcall %_can_unload_now() noexcept
     winrt::clear_factory_cache();
     return true;
 }
-
+%
 void* __stdcall %_get_activation_factory([[maybe_unused]] std::wstring_view const& name)
 {
     auto requal = [](std::wstring_view const& left, std::wstring_view const& right) noexcept
@@ -158,13 +352,15 @@ void* __stdcall %_get_activation_factory([[maybe_unused]] std::wstring_view cons
 %
     return nullptr;
 }
-)";
+%)";
 
         w.write(format,
             bind_each<write_component_include>(classes),
             settings.component_lib,
+            bind<write_component_activation_statistics>(classes),
             settings.component_lib,
-            bind_each<write_component_activation>(classes));
+            bind<write_component_activations>(classes),
+            bind<write_component_registrations>(classes));
 
         if (settings.component_lib != "winrt")
         {
@@ -2,50 +2,153 @@
 
 namespace cppwinrt
 {
+    struct base_shard
+    {
+        std::string_view name;
+        std::vector<std::string_view> depends;
+        std::vector<std::string_view> fragments;
+    };
+
+    // The base.h fragments grouped into feature headers, each including only the shards it depends on.
+    // Errors are part of core because hstring and com_ptr rely on them.
+    static std::vector<base_shard> const& get_base_shards()
+    {
+        static std::vector<base_shard> const shards
+        {
+            { "core", {},
+            {
+                strings::base_includes,
+                strings::base_macros,
+                strings::base_types,
+                strings::base_extern,
+                strings::base_meta,
+                strings::base_identity,
+                strings::base_handle,
+                strings::base_lock,
+                strings::base_abi,
+                strings::base_windows,
+                strings::base_com_ptr,
+                strings::base_string,
+                strings::base_string_input,
+                strings::base_string_operators,
+                strings::base_array,
+                strings::base_weak_ref,
+                strings::base_agile_ref,
+                strings::base_error,
+                strings::base_marshaler,
+            } },
+            { "events", { "core" },
+            {
+                strings::base_delegate,
+                strings::base_events,
+            } },
+            { "activation", { "core" },
+            {
+                strings::base_activation,
+            } },
+            { "implements", { "core", "activation" },
+            {
+                strings::base_implements,
+                strings::base_composable,
+            } },
+            { "foundation", { "core" },
+            {
+                strings::base_foundation,
+                strings::base_chrono,
+                strings::base_security,
+                strings::base_std_hash,
+                strings::base_iterator,
+            } },
+            { "coroutines", { "core" },
+            {
+                strings::base_coroutine_threadpool,
+            } },
+        };
+
+        return shards;
+    }
+
     static void write_base_h()
     {
         writer w;
         write_preamble(w);
-        w.write(strings::base_version_odr, CPPWINRT_VERSION_STRING);
+
+        // When split, the version is defined by the core shard.
+        if (!settings.split_base)
+        {
+            w.write(strings::base_version_odr, CPPWINRT_VERSION_STRING);
+        }
+
         {
             auto wrap_file_guard = wrap_open_file_guard(w, "BASE");
 
-            w.write(strings::base_includes);
-            w.write(strings::base_macros);
-            w.write(strings::base_types);
-            w.write(strings::base_extern);
-            w.write(strings::base_meta);
-            w.write(strings::base_identity);
-            w.write(strings::base_handle);
-            w.write(strings::base_lock);
-            w.write(strings::base_abi);
-            w.write(strings::base_windows);
-            w.write(strings::base_com_ptr);
-            w.write(strings::base_string);
-            w.write(strings::base_string_input);
-            w.write(strings::base_string_operators);
-            w.write(strings::base_array);
-            w.write(strings::base_weak_ref);
-            w.write(strings::base_agile_ref);
-            w.write(strings::base_error);
-            w.write(strings::base_marshaler);
-            w.write(strings::base_delegate);
-            w.write(strings::base_events);
-            w.write(strings::base_activation);
-            w.write(strings::base_implements);
-            w.write(strings::base_composable);
-            w.write(strings::base_foundation);
-            w.write(strings::base_chrono);
-            w.write(strings::base_security);
-            w.write(strings::base_std_hash);
-            w.write(strings::base_iterator);
-            w.write(strings::base_coroutine_threadpool);
-            w.write(strings::base_natvis);
-            w.write(strings::base_version);
+            for (auto&& shard : get_base_shards())
+            {
+                if (settings.split_base)
+                {
+                    w.write_root_include(w.write_temp("base/%", shard.name));
+                    continue;
+                }
+
+                for (auto&& fragment : shard.fragments)
+                {
+                    w.write(fragment);
+                }
+            }
+
+            if (!settings.split_base)
+            {
+                w.write(strings::base_natvis);
+                w.write(strings::base_version);
+            }
         }
         w.flush_to_file(settings.output_folder + "winrt/base.h");
     }
 
+    static void write_base_shards()
+    {
+        create_directories(settings.output_folder + "winrt/base");
+
+        for (auto&& shard : get_base_shards())
+        {
+            writer w;
+            write_preamble(w);
+
+            // Core is included by every other shard, so it also carries the version and natvis support.
+            bool const core = shard.depends.empty();
+
+            if (core)
+            {
+                w.write(strings::base_version_odr, CPPWINRT_VERSION_STRING);
+            }
+
+            std::string guard{ "BASE_" };
+            std::transform(shard.name.begin(), shard.name.end(), std::back_inserter(guard), ::toupper);
+
+            {
+                auto wrap_file_guard = wrap_open_file_guard(w, guard);
+
+                for (auto&& depends : shard.depends)
+                {
+                    w.write_root_include(w.write_temp("base/%", depends));
+                }
+
+                for (auto&& fragment : shard.fragments)
+                {
+                    w.write(fragment);
+                }
+
+                if (core)
+                {
+                    w.write(strings::base_natvis);
+                    w.write(strings::base_version);
+                }
+            }
+
+            w.flush_to_file(settings.output_folder + "winrt/base/" + std::string(shard.name) + ".h");
+        }
+    }
+
     static void write_fast_forward_h(std::vector<TypeDef> const& classes)
     {
         writer w;
@@ -65,7 +168,7 @@ namespace cppwinrt
         w.flush_to_file(settings.output_folder + "winrt/fast_forward.h");
     }
 
-    static void write_namespace_0_h(std::string_view const& ns, cache::namespace_members const& members)
+    static void write_namespace_0_h(std::string_view const& ns, cache::namespace_members const& members, namespace_cache::depends_type& result)
     {
         writer w;
         w.type_namespace = ns;
@@ -115,10 +218,11 @@ namespace cppwinrt
             w.write_each<write_forward>(depends.second);
         }
 
+        record_depends(result, w);
         w.save_header('0');
     }
 
-    static void write_namespace_1_h(std::string_view const& ns, cache::namespace_members const& members)
+    static void write_namespace_1_h(std::string_view const& ns, cache::namespace_members const& members, namespace_cache::depends_type& result)
     {
         writer w;
         w.type_namespace = ns;
@@ -140,10 +244,11 @@ namespace cppwinrt
         }
 
         w.write_depends(w.type_namespace, '0');
+        record_depends(result, w);
         w.save_header('1');
     }
 
-    static void write_namespace_2_h(std::string_view const& ns, cache::namespace_members const& members)
+    static void write_namespace_2_h(std::string_view const& ns, cache::namespace_members const& members, namespace_cache::depends_type& result)
     {
         writer w;
         w.type_namespace = ns;
@@ -170,10 +275,11 @@ namespace cppwinrt
         }
 
         w.write_depends(w.type_namespace, '1');
+        record_depends(result, w);
         w.save_header('2');
     }
 
-    static void write_namespace_h(cache const& c, std::string_view const& ns, cache::namespace_members const& members)
+    static void write_namespace_h(cache const& c, std::string_view const& ns, cache::namespace_members const& members, namespace_cache::depends_type& result)
     {
         writer w;
         w.type_namespace = ns;
@@ -209,7 +315,7 @@ namespace cppwinrt
         write_preamble(w);
         write_open_file_guard(w, ns);
         write_version_assert(w);
-        write_parent_depends(w, c, ns);
+        auto parent = write_parent_depends(w, c, ns);
 
         for (auto&& depends : w.depends)
         {
@@ -217,9 +323,146 @@ namespace cppwinrt
         }
 
         w.write_depends(w.type_namespace, '2');
+        record_depends(result, w);
+
+        if (!parent.empty())
+        {
+            result.insert(parent);
+        }
         w.save_header();
     }
 
+    struct namespace_cluster
+    {
+        std::vector<std::string_view> namespaces;
+        std::set<size_t> depends;
+        size_t level{};
+    };
+
+    // Namespaces may depend on each other, so the graph is condensed into strongly connected components,
+    // which Tarjan's algorithm produces in dependency order.
+    static std::vector<namespace_cluster> get_namespace_clusters(std::map<std::string_view, std::set<std::string_view>> const& graph)
+    {
+        struct node
+        {
+            size_t index{};
+            size_t low{};
+            size_t cluster{};
+            bool visited{};
+            bool on_stack{};
+        };
+
+        std::map<std::string_view, node> nodes;
+        std::vector<std::string_view> stack;
+        std::vector<namespace_cluster> clusters;
+        size_t next_index{};
+
+        auto visit = [&](auto&& self, std::string_view const& ns) -> void
+        {
+            auto& current = nodes[ns];
+            current.index = current.low = next_index++;
+            current.visited = true;
+            current.on_stack = true;
+            stack.push_back(ns);
+
+            for (auto&& depends : graph.at(ns))
+            {
+                if (graph.find(depends) == graph.end())
+                {
+                    continue;
+                }
+
+                auto& target = nodes[depends];
+
+                if (!target.visited)
+                {
+                    self(self, depends);
+                    nodes[ns].low = std::min(nodes[ns].low, nodes[depends].low);
+                }
+                else if (target.on_stack)
+                {
+                    nodes[ns].low = std::min(nodes[ns].low, target.index);
+                }
+            }
+
+            if (nodes[ns].low != nodes[ns].index)
+            {
+                return;
+            }
+
+            namespace_cluster cluster;
+            std::string_view member;
+
+            do
+            {
+                member = stack.back();
+                stack.pop_back();
+                nodes[member].on_stack = false;
+                nodes[member].cluster = clusters.size();
+                cluster.namespaces.push_back(member);
+            } while (member != ns);
+
+            std::sort(cluster.namespaces.begin(), cluster.namespaces.end());
+            clusters.push_back(std::move(cluster));
+        };
+
+        for (auto&& [ns, depends] : graph)
+        {
+            if (!nodes[ns].visited)
+            {
+                visit(visit, ns);
+            }
+        }
+
+        for (auto&& cluster : clusters)
+        {
+            for (auto&& ns : cluster.namespaces)
+            {
+                for (auto&& depends : graph.at(ns))
+                {
+                    auto target = nodes.find(depends);
+
+                    if (target != nodes.end() && target->second.cluster != nodes[ns].cluster)
+                    {
+                        cluster.depends.insert(target->second.cluster);
+                    }
+                }
+            }
+
+            for (auto&& depends : cluster.depends)
+            {
+                cluster.level = std::max(cluster.level, clusters[depends].level + 1);
+            }
+        }
+
+        return clusters;
+    }
+
+    static void write_module_graph(std::map<std::string_view, std::set<std::string_view>> const& graph)
+    {
+        auto clusters = get_namespace_clusters(graph);
+
+        writer w;
+        w.write("{\n  \"version\": \"%\",\n  \"clusters\": [", CPPWINRT_VERSION_STRING);
+
+        for (size_t id = 0; id != clusters.size(); ++id)
+        {
+            auto const& cluster = clusters[id];
+
+            w.write("%\n    { \"id\": %, \"level\": %, \"namespaces\": [ %%% ], \"depends\": [ % ] }",
+                id ? "," : "",
+                static_cast<uint64_t>(id),
+                static_cast<uint64_t>(cluster.level),
+                '"',
+                bind_list("\", \"", cluster.namespaces),
+                '"',
+                bind_list(", ", cluster.depends));
+        }
+
+        w.write("\n  ]\n}\n");
+        w.flush_to_file(settings.output_folder + "winrt/winrt.modules.json");
+    }
+
     static void write_module_g_cpp(std::vector<TypeDef> const& classes)
     {
         writer w;
@@ -855,6 +855,16 @@ namespace cppwinrt
             !members.delegates.empty();
     }
 
+    static size_t get_type_count(cache::namespace_members const& members)
+    {
+        return
+            members.interfaces.size() +
+            members.classes.size() +
+            members.enums.size() +
+            members.structs.size() +
+            members.delegates.size();
+    }
+
     static bool can_produce(TypeDef const& type, cache const& c)
     {
         auto attribute = get_attribute(type, "Windows.Foundation.Metadata", "ExclusiveToAttribute");
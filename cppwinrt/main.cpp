@@ -6,6 +6,8 @@
 #include "helpers.h"
 #include "code_writers.h"
 #include "component_writers.h"
+#include "namespace_cache.h"
+#include "profiler.h"
 #include "file_writers.h"
 #include "type_writers.h"
 
@@ -30,6 +32,14 @@ namespace cppwinrt
         { "exclude", 0, option::no_max, "<prefix>", "One or more prefixes to exclude from input" },
         { "base", 0, 0, {}, "Generate base.h unconditionally" },
         { "optimize", 0, 0, {}, "Generate component projection with unified construction support" },
+        { "activation_stats", 0, 0, {}, "Generate component activation counters and timers in module.g.cpp" },
+        { "activation_registry", 0, 0, {}, "Generate a function registering component factories for static linking" },
+        { "incremental", 0, 0, {}, "Skip namespaces whose metadata has not changed since the last run" },
+        { "rewrite", 0, 0, {}, "Write generated files even if their contents are unchanged" },
+        { "jobs", 0, 1, "<count>", "Number of threads used to generate files (defaults to processor count)" },
+        { "profile", 0, 1, "<path>", "Save a Chrome trace of generation phases and file sizes" },
+        { "split_base", 0, 0, {}, "Generate base.h as an umbrella over separately includable feature headers" },
+        { "module_graph", 0, 0, {}, "Generate winrt.modules.json describing the namespace dependency graph" },
         { "help", 0, option::no_max, {}, "Show detailed help with examples" },
         { "?", 0, option::no_max, {}, {} },
         { "library", 0, 1, "<prefix>", "Specify library prefix (defaults to winrt)" },
@@ -87,9 +97,13 @@ Where <spec> is one or more of:
 
         settings.component = args.exists("component");
         settings.base = args.exists("base");
+        settings.split_base = args.exists("split_base");
+        settings.module_graph = args.exists("module_graph");
 
         settings.license = args.exists("license");
         settings.brackets = args.exists("brackets");
+        settings.incremental = args.exists("incremental");
+        file_writes.always_write = args.exists("rewrite");
 
         path output_folder = args.value("output", ".");
         create_directories(output_folder / "winrt/impl");
@@ -134,6 +148,8 @@ Where <spec> is one or more of:
             settings.component_lib = args.value("library", "winrt");
             settings.component_opt = args.exists("optimize");
             settings.component_ignore_velocity = args.exists("ignore_velocity");
+            settings.component_activation_stats = args.exists("activation_stats");
+            settings.component_activation_registry = args.exists("activation_registry");
 
             if (settings.component_pch == ".")
             {
@@ -151,11 +167,40 @@ Where <spec> is one or more of:
         }
     }
 
+    static uint32_t get_jobs(reader const& args)
+    {
+        if (args.exists("synchronous"))
+        {
+            return 1;
+        }
+
+        auto value = args.value("jobs");
+
+        if (value.empty())
+        {
+            return 0;
+        }
+
+        char* end{};
+        auto jobs = strtoul(value.c_str(), &end, 10);
+
+        if (*end || jobs == 0 || jobs > 1024)
+        {
+            throw_invalid("Invalid value '", value, "' for option -jobs");
+        }
+
+        return static_cast<uint32_t>(jobs);
+    }
+
     static auto get_files_to_cache()
     {
         std::vector<std::string> files;
         files.insert(files.end(), settings.input.begin(), settings.input.end());
-        files.insert(files.end(), settings.reference.begin(), settings.reference.end());
+
+        // A winmd that is both an input and a reference only needs to be loaded once.
+        std::set_difference(settings.reference.begin(), settings.reference.end(),
+            settings.input.begin(), settings.input.end(), std::back_inserter(files));
+
         return files;
     }
 
@@ -260,11 +305,25 @@ Where <spec> is one or more of:
             }
 
             process_args(args);
+
+            if (args.exists("profile"))
+            {
+                profile.start(args.value("profile"));
+            }
+
+            auto load_scope = profile.measure("load");
             cache c{ get_files_to_cache(), [](TypeDef const& type) { return type.Flags().WindowsRuntime(); } };
             remove_foundation_types(c);
-            build_filters(c);
+            load_scope.end();
+            {
+                auto scope = profile.measure("build_filters");
+                build_filters(c);
+            }
             settings.base = settings.base || (!settings.component && settings.projection_filter.empty());
-            build_fastabi_cache(c);
+            {
+                auto scope = profile.measure("build_fastabi_cache");
+                build_fastabi_cache(c);
+            }
 
             if (settings.verbose)
             {
@@ -290,8 +349,15 @@ Where <spec> is one or more of:
             }
 
             w.flush_to_console();
+            namespace_cache incremental;
+
+            if (settings.incremental)
+            {
+                incremental.load(settings.output_folder + "winrt/cppwinrt.cache", c);
+            }
+
             task_group group;
-            group.synchronous(args.exists("synchronous"));
+            group.jobs(get_jobs(args));
             writer ixx;
             write_preamble(ixx);
             ixx.write("module;\n");
@@ -307,19 +373,47 @@ Where <spec> is one or more of:
 
                 ixx.write("#include \"winrt/%.h\"\n", ns);
 
-                group.add([&, &ns = ns, &members = members]
+                if (incremental.up_to_date(c, ns))
                 {
-                    write_namespace_0_h(ns, members);
-                    write_namespace_1_h(ns, members);
-                    write_namespace_2_h(ns, members);
-                    write_namespace_h(c, ns, members);
-                });
+                    incremental.keep(ns);
+                    continue;
+                }
+
+                group.add([&, &ns = ns, &members = members, &depends = incremental.add(ns)]
+                {
+                    {
+                        auto scope = profile.measure("write_namespace_0_h", ns);
+                        write_namespace_0_h(ns, members, depends);
+                    }
+                    {
+                        auto scope = profile.measure("write_namespace_1_h", ns);
+                        write_namespace_1_h(ns, members, depends);
+                    }
+                    {
+                        auto scope = profile.measure("write_namespace_2_h", ns);
+                        write_namespace_2_h(ns, members, depends);
+                    }
+                    {
+                        auto scope = profile.measure("write_namespace_h", ns);
+                        write_namespace_h(c, ns, members, depends);
+                    }
+                }, get_type_count(members));
             }
 
             if (settings.base)
             {
-                write_base_h();
-                ixx.flush_to_file(settings.output_folder + "winrt/winrt.ixx");
+                group.add([&]
+                {
+                    auto scope = profile.measure("write_base_h");
+                    write_base_h();
+
+                    if (settings.split_base)
+                    {
+                        write_base_shards();
+                    }
+
+                    ixx.flush_to_file(settings.output_folder + "winrt/winrt.ixx");
+                });
             }
 
             if (settings.component)
@@ -339,23 +433,48 @@ Where <spec> is one or more of:
 
                 if (!classes.empty())
                 {
-                    write_fast_forward_h(classes);
-                    write_module_g_cpp(classes);
+                    // Component files are written by a single task as they may share output folders.
+                    auto const weight = classes.size();
 
-                    for (auto&& type : classes)
+                    group.add([classes = std::move(classes)]
                     {
-                        write_component_g_h(type);
-                        write_component_g_cpp(type);
-                        write_component_h(type);
-                        write_component_cpp(type);
-                    }
+                        auto scope = profile.measure("write_component");
+                        write_fast_forward_h(classes);
+                        write_module_g_cpp(classes);
+
+                        for (auto&& type : classes)
+                        {
+                            write_component_g_h(type);
+                            write_component_g_cpp(type);
+                            write_component_h(type);
+                            write_component_cpp(type);
+                        }
+                    }, weight);
                 }
             }
 
-            group.get();
+            {
+                auto scope = profile.measure("generate");
+                group.get();
+            }
+            incremental.save(c);
+
+            if (settings.module_graph)
+            {
+                write_module_graph(incremental.get_depends());
+            }
+
+            profile.save();
 
             if (settings.verbose)
             {
+                if (settings.incremental)
+                {
+                    w.write(" skip:  % unchanged namespaces\n", incremental.skipped());
+                }
+
+                w.write(" files: % written, % unchanged\n", file_writes.written.load(), file_writes.unchanged.load());
+
                 w.write(" time:  %ms\n", get_elapsed_time(start));
             }
         }
@@ -0,0 +1,343 @@
+#pragma once
+
+namespace cppwinrt
+{
+    // Persists a fingerprint of the metadata behind each generated namespace, including the namespaces
+    // it depended on, so that unchanged namespaces can be skipped. The dependencies also feed the module graph.
+    struct namespace_cache
+    {
+        using depends_type = std::set<std::string_view>;
+
+        namespace_cache(namespace_cache const&) = delete;
+        namespace_cache& operator=(namespace_cache const&) = delete;
+
+        namespace_cache() noexcept = default;
+
+        void load(std::string const& filename, cache const& c)
+        {
+            m_filename = filename;
+            m_enabled = true;
+            m_global = get_global_hash(c);
+
+            for (auto&& db : c.databases())
+            {
+                m_files[db.path()] = hash_file(db.path());
+            }
+
+            std::ifstream file(filename);
+            std::string line;
+
+            if (!std::getline(file, line) || line != get_header())
+            {
+                return;
+            }
+
+            while (std::getline(file, line))
+            {
+                std::istringstream stream(line);
+                std::string ns;
+                entry value;
+
+                if (!(stream >> ns >> std::hex >> value.fingerprint))
+                {
+                    continue;
+                }
+
+                std::string depends;
+
+                while (stream >> depends)
+                {
+                    value.depends.insert(std::move(depends));
+                }
+
+                m_previous.emplace(std::move(ns), std::move(value));
+            }
+        }
+
+        bool up_to_date(cache const& c, std::string_view const& ns) const
+        {
+            if (!m_enabled)
+            {
+                return false;
+            }
+
+            auto previous = m_previous.find(ns);
+
+            if (previous == m_previous.end())
+            {
+                return false;
+            }
+
+            for (char const* suffix : { ".0.h", ".1.h", ".2.h" })
+            {
+                if (!exists(settings.output_folder + "winrt/impl/" + std::string(ns) + suffix))
+                {
+                    return false;
+                }
+            }
+
+            if (!exists(settings.output_folder + "winrt/" + std::string(ns) + ".h"))
+            {
+                return false;
+            }
+
+            return previous->second.fingerprint == get_fingerprint(c, ns, previous->second.depends);
+        }
+
+        // Must be called serially. The returned set is only ever written by the one task that
+        // generates the namespace, and std::map insertion does not invalidate existing elements.
+        depends_type& add(std::string_view const& ns)
+        {
+            return m_current[ns];
+        }
+
+        void keep(std::string_view const& ns)
+        {
+            if (!m_enabled)
+            {
+                return;
+            }
+
+            auto previous = m_previous.find(ns);
+            assert(previous != m_previous.end());
+            m_saved.emplace(std::string(ns), previous->second);
+            ++m_skipped;
+        }
+
+        uint32_t skipped() const noexcept
+        {
+            return m_skipped;
+        }
+
+        void save(cache const& c)
+        {
+            for (auto&& [ns, depends] : m_current)
+            {
+                entry value;
+                value.depends.insert(depends.begin(), depends.end());
+
+                if (m_enabled)
+                {
+                    value.fingerprint = get_fingerprint(c, ns, value.depends);
+                }
+
+                m_saved.emplace(std::string(ns), std::move(value));
+            }
+
+            if (!m_enabled)
+            {
+                return;
+            }
+
+            writer w;
+            w.write("%\n", get_header());
+
+            for (auto&& [ns, value] : m_saved)
+            {
+                w.write("% %", ns, to_hex(value.fingerprint));
+
+                for (auto&& depends : value.depends)
+                {
+                    w.write(" %", depends);
+                }
+
+                w.write('\n');
+            }
+
+            w.flush_to_file(m_filename);
+        }
+
+        // Available after save, this includes the dependencies of both generated and skipped namespaces.
+        std::map<std::string_view, std::set<std::string_view>> get_depends() const
+        {
+            std::map<std::string_view, std::set<std::string_view>> result;
+
+            for (auto&& [ns, value] : m_saved)
+            {
+                auto& depends = result[ns];
+                depends.insert(value.depends.begin(), value.depends.end());
+            }
+
+            return result;
+        }
+
+    private:
+
+        struct entry
+        {
+            uint64_t fingerprint{};
+            std::set<std::string, std::less<>> depends;
+        };
+
+        static constexpr uint64_t hash_offset{ 0xcbf29ce484222325 };
+        static constexpr uint64_t hash_prime{ 0x100000001b3 };
+
+        static uint64_t hash_data(void const* data, size_t size, uint64_t result = hash_offset) noexcept
+        {
+            auto bytes = static_cast<uint8_t const*>(data);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                result ^= bytes[i];
+                result *= hash_prime;
+            }
+
+            return result;
+        }
+
+        static uint64_t hash_string(std::string_view const& value, uint64_t result) noexcept
+        {
+            // The terminating zero separates adjacent strings so that "ab" + "c" != "a" + "bc".
+            result = hash_data(value.data(), value.size(), result);
+            return hash_data("", 1, result);
+        }
+
+        // Inputs are hashed by content, while references, often the entire SDK, are identified by size and time.
+        static uint64_t hash_file(std::string const& filename)
+        {
+            if (settings.input.count(filename))
+            {
+                auto contents = file_to_string(filename);
+                return hash_data(contents.data(), contents.size());
+            }
+
+            uint64_t const values[]
+            {
+                static_cast<uint64_t>(file_size(filename)),
+                static_cast<uint64_t>(last_write_time(filename).time_since_epoch().count()),
+            };
+
+            return hash_data(values, sizeof(values));
+        }
+
+        static std::string get_header()
+        {
+            return std::string("cppwinrt ") + CPPWINRT_VERSION_STRING;
+        }
+
+        static std::string to_hex(uint64_t value)
+        {
+            char buffer[17];
+            sprintf_s(buffer, "%016llx", static_cast<unsigned long long>(value));
+            return buffer;
+        }
+
+        static uint64_t get_global_hash(cache const& c)
+        {
+            uint64_t result = hash_string(CPPWINRT_VERSION_STRING, hash_offset);
+
+            bool const options[]
+            {
+                settings.fastabi,
+                settings.license,
+                settings.brackets,
+                settings.component,
+                settings.component_opt,
+                settings.component_ignore_velocity,
+            };
+
+            result = hash_data(options, sizeof(options), result);
+
+            // The projection filter is built from the types in the inputs, so moving a winmd between
+            // -input and -reference changes which namespaces are projected.
+            for (auto&& input : settings.input)
+            {
+                result = hash_string(input, result);
+            }
+
+            result = hash_string("-", result);
+
+            for (auto&& reference : settings.reference)
+            {
+                result = hash_string(reference, result);
+            }
+
+            result = hash_string("-", result);
+
+            for (auto&& include : settings.include)
+            {
+                result = hash_string(include, result);
+            }
+
+            result = hash_string("-", result);
+
+            for (auto&& exclude : settings.exclude)
+            {
+                result = hash_string(exclude, result);
+            }
+
+            // Adding or removing a namespace affects the parent includes of other namespaces.
+            for (auto&& [ns, members] : c.namespaces())
+            {
+                result = hash_string(ns, result);
+            }
+
+            return result;
+        }
+
+        uint64_t hash_namespace(cache const& c, std::string_view const& ns, uint64_t result) const
+        {
+            result = hash_string(ns, result);
+            auto members = c.namespaces().find(ns);
+
+            if (members == c.namespaces().end())
+            {
+                return result;
+            }
+
+            std::set<std::string_view> files;
+
+            auto add_files = [&](std::vector<TypeDef> const& types)
+            {
+                for (auto&& type : types)
+                {
+                    files.insert(type.get_database().path());
+                }
+            };
+
+            add_files(members->second.interfaces);
+            add_files(members->second.classes);
+            add_files(members->second.enums);
+            add_files(members->second.structs);
+            add_files(members->second.delegates);
+
+            for (auto&& file : files)
+            {
+                auto hash = m_files.find(file);
+                assert(hash != m_files.end());
+                result = hash_data(&hash->second, sizeof(hash->second), result);
+            }
+
+            return result;
+        }
+
+        uint64_t get_fingerprint(cache const& c, std::string_view const& ns, std::set<std::string, std::less<>> const& depends) const
+        {
+            uint64_t result = hash_namespace(c, ns, m_global);
+
+            for (auto&& depends_ns : depends)
+            {
+                result = hash_namespace(c, depends_ns, result);
+            }
+
+            return result;
+        }
+
+        bool m_enabled{};
+        uint32_t m_skipped{};
+        uint64_t m_global{};
+        std::string m_filename;
+        std::map<std::string, uint64_t, std::less<>> m_files;
+        std::map<std::string, entry, std::less<>> m_previous;
+        std::map<std::string_view, depends_type> m_current;
+        std::map<std::string, entry, std::less<>> m_saved;
+    };
+
+    inline void record_depends(namespace_cache::depends_type& result, writer const& w)
+    {
+        for (auto&& [ns, types] : w.depends)
+        {
+            result.insert(ns);
+        }
+    }
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <psapi.h>
+
+namespace cppwinrt
+{
+    // Records generation phases and file sizes as a Chrome trace for chrome://tracing or ui.perfetto.dev.
+    struct profiler
+    {
+        struct scope
+        {
+            scope(scope const&) = delete;
+            scope& operator=(scope const&) = delete;
+
+            scope(profiler* owner, std::string_view const& name, std::string_view const& ns) :
+                m_owner(owner),
+                m_name(name),
+                m_namespace(ns),
+                m_start(owner ? owner->now() : 0)
+            {
+            }
+
+            ~scope()
+            {
+                end();
+            }
+
+            void end()
+            {
+                if (m_owner)
+                {
+                    m_owner->add_event(m_name, m_namespace, m_start, m_owner->now() - m_start);
+                    m_owner = nullptr;
+                }
+            }
+
+        private:
+
+            profiler* m_owner{};
+            std::string_view m_name;
+            std::string_view m_namespace;
+            int64_t m_start{};
+        };
+
+        void start(std::string const& filename)
+        {
+            m_filename = filename;
+            m_start = std::chrono::steady_clock::now();
+            m_enabled = true;
+
+            file_writes.on_flush = [this](std::string const& filename, size_t bytes, bool written)
+            {
+                add_file(filename, bytes, written);
+            };
+        }
+
+        [[nodiscard]] scope measure(std::string_view const& name, std::string_view const& ns = {})
+        {
+            return { m_enabled ? this : nullptr, name, ns };
+        }
+
+        void save()
+        {
+            if (!m_enabled)
+            {
+                return;
+            }
+
+            file_writes.on_flush = nullptr;
+
+            PROCESS_MEMORY_COUNTERS counters{ sizeof(counters) };
+            GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+
+            writer w;
+            w.write("{\"traceEvents\":[\n");
+
+            for (auto&& event : m_events)
+            {
+                w.write("%,\n", event);
+            }
+
+            w.write(R"({"name":"memory","ph":"C","ts":%,"pid":1,"tid":%,"args":{"peak_working_set":%,"peak_pagefile":%}})",
+                now(),
+                static_cast<uint32_t>(GetCurrentThreadId()),
+                static_cast<uint64_t>(counters.PeakWorkingSetSize),
+                static_cast<uint64_t>(counters.PeakPagefileUsage));
+
+            w.write("\n],\"displayTimeUnit\":\"ms\"}\n");
+            w.flush_to_file(m_filename);
+        }
+
+    private:
+
+        int64_t now() const
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+        }
+
+        static std::string escape(std::string_view const& value)
+        {
+            std::string result;
+            result.reserve(value.size());
+
+            for (auto c : value)
+            {
+                if (c == '\\' || c == '"')
+                {
+                    result += '\\';
+                }
+
+                result += c;
+            }
+
+            return result;
+        }
+
+        void add_event(std::string_view const& name, std::string_view const& ns, int64_t start, int64_t duration)
+        {
+            writer w;
+            w.write(R"({"name":"%","cat":"phase","ph":"X","ts":%,"dur":%,"pid":1,"tid":%)",
+                name,
+                start,
+                duration,
+                static_cast<uint32_t>(GetCurrentThreadId()));
+
+            if (!ns.empty())
+            {
+                w.write(R"(,"args":{"namespace":"%"})", ns);
+            }
+
+            w.write('}');
+            auto event = w.flush_to_string();
+            std::lock_guard lock(m_lock);
+            m_events.push_back(std::move(event));
+        }
+
+        void add_file(std::string const& filename, size_t bytes, bool written)
+        {
+            writer w;
+            w.write(R"({"name":"%","cat":"file","ph":"i","s":"t","ts":%,"pid":1,"tid":%,"args":{"bytes":%,"written":%}})",
+                escape(filename),
+                now(),
+                static_cast<uint32_t>(GetCurrentThreadId()),
+                static_cast<uint64_t>(bytes),
+                written ? "true" : "false");
+
+            auto event = w.flush_to_string();
+            std::lock_guard lock(m_lock);
+            m_events.push_back(std::move(event));
+        }
+
+        bool m_enabled{};
+        std::string m_filename;
+        std::chrono::steady_clock::time_point m_start;
+        std::mutex m_lock;
+        std::vector<std::string> m_events;
+    };
+
+    inline profiler profile;
+}
@@ -9,9 +9,12 @@ namespace cppwinrt
 
         std::string output_folder;
         bool base{};
+        bool split_base{};
+        bool module_graph{};
         bool license{};
         bool brackets{};
         bool verbose{};
+        bool incremental{};
         bool component{};
         std::string component_folder;
         std::string component_name;
@@ -21,6 +24,8 @@ namespace cppwinrt
         std::string component_lib;
         bool component_opt{};
         bool component_ignore_velocity{};
+        bool component_activation_stats{};
+        bool component_activation_registry{};
 
         std::set<std::string> include;
         std::set<std::string> exclude;
@@ -1,7 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace cppwinrt
 {
+    // Runs the collected tasks, heaviest first, on a fixed number of threads including the caller. A job
+    // count of zero uses one thread per processor and a job count of one is what -synchronous selects.
     struct task_group
     {
         task_group(task_group const&) = delete;
@@ -9,50 +19,105 @@ namespace cppwinrt
 
         task_group() noexcept = default;
 
-        ~task_group() noexcept
+        void jobs(uint32_t jobs) noexcept
         {
-            for (auto&& task : m_tasks)
-            {
-                task.wait();
-            }
-        }
-
-        void synchronous(bool synchronous) noexcept
-        {
-            m_synchronous = synchronous;
+            m_jobs = jobs;
         }
 
         template <typename T>
-        void add(T&& callback)
+        void add(T&& callback, size_t weight = 0)
         {
-            if (m_synchronous)
-            {
-                callback();
-            }
-            else
-            {
-                m_tasks.push_back(std::async(std::forward<T>(callback)));
-            }
+            m_tasks.push_back({ weight, std::forward<T>(callback) });
         }
 
         void get()
         {
             auto tasks = std::move(m_tasks);
 
-            for (auto&& task : tasks)
+            std::stable_sort(tasks.begin(), tasks.end(), [](task const& left, task const& right)
             {
-                task.wait();
+                return left.weight > right.weight;
+            });
+
+            std::atomic<size_t> next{};
+            std::atomic<bool> failed{};
+            std::exception_ptr error;
+            std::mutex error_lock;
+
+            auto worker = [&]
+            {
+                while (!failed)
+                {
+                    auto const index = next++;
+
+                    if (index >= tasks.size())
+                    {
+                        break;
+                    }
+
+                    try
+                    {
+                        tasks[index].callback();
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock(error_lock);
+
+                        if (!error)
+                        {
+                            error = std::current_exception();
+                        }
+
+                        failed = true;
+                    }
+                }
+            };
+
+            uint32_t jobs = m_jobs ? m_jobs : std::thread::hardware_concurrency();
+            jobs = static_cast<uint32_t>(std::min<size_t>(std::max(jobs, 1u), tasks.size()));
+            std::vector<std::thread> threads;
+
+            auto join = [&]
+            {
+                for (auto&& thread : threads)
+                {
+                    thread.join();
+                }
+            };
+
+            try
+            {
+                for (uint32_t i = 1; i < jobs; ++i)
+                {
+                    threads.emplace_back(worker);
+                }
+            }
+            catch (...)
+            {
+                // Destroying a joinable thread terminates the process.
+                failed = true;
+                join();
+                throw;
             }
 
-            for (auto&& task : tasks)
+            worker();
+            join();
+
+            if (error)
             {
-                task.get();
+                std::rethrow_exception(error);
             }
         }
 
     private:
 
-        std::vector<std::future<void>> m_tasks;
-        bool m_synchronous{};
+        struct task
+        {
+            size_t weight{};
+            std::function<void()> callback;
+        };
+
+        std::vector<task> m_tasks;
+        uint32_t m_jobs{};
     };
 }
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -15,6 +17,17 @@ namespace cppwinrt
         return static_cast<std::stringstream const&>(std::stringstream() << file.rdbuf()).str();
     }
 
+    // Controls whether flush_to_file skips files whose contents are unchanged and counts the outcome.
+    struct file_write_options
+    {
+        bool always_write{};
+        std::atomic<uint32_t> written{};
+        std::atomic<uint32_t> unchanged{};
+        std::function<void(std::string const& filename, size_t bytes, bool written)> on_flush;
+    };
+
+    inline file_write_options file_writes;
+
     template <typename T>
     struct writer_base
     {
@@ -155,8 +168,20 @@ namespace cppwinrt
 
         void flush_to_file(std::string const& filename)
         {
-            if (!file_equal(filename))
+            bool const unchanged = !file_writes.always_write && file_equal(filename);
+
+            if (file_writes.on_flush)
+            {
+                file_writes.on_flush(filename, m_first.size() + m_second.size(), !unchanged);
+            }
+
+            if (unchanged)
+            {
+                ++file_writes.unchanged;
+            }
+            else
             {
+                ++file_writes.written;
                 std::ofstream file;
                 file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
                 try
@@ -197,7 +222,11 @@ namespace cppwinrt
 
         bool file_equal(std::string const& filename) const
         {
-            if (!std::filesystem::exists(filename))
+            std::error_code ec;
+            auto const size = std::filesystem::file_size(filename, ec);
+
+            // Avoid reading the file when a size mismatch (or missing file) already proves it differs.
+            if (ec || size != m_first.size() + m_second.size())
             {
                 return false;
             }
@@ -0,0 +1,72 @@
+@echo off
+setlocal
+
+rem Runs the generator with options that only change how the projection is produced and checks
+rem that the headers match those of a plain run.
+
+set target_platform=%1
+set target_configuration=%2
+
+if "%target_platform%"=="" set target_platform=x64
+if "%target_configuration%"=="" set target_configuration=Release
+
+set cppwinrt=_build\%target_platform%\%target_configuration%\cppwinrt.exe
+set output=_build\%target_platform%\%target_configuration%\generator_tests
+set foundation=%windir%\System32\WinMetadata\Windows.Foundation.winmd
+
+if exist %output% rmdir /s /q %output%
+
+%cppwinrt% -in local -out %output%\expected || goto :failed
+
+rem Unchanged files are left alone unless -rewrite is given.
+%cppwinrt% -in local -out %output%\expected -verbose > %output%\unchanged.txt || goto :failed
+findstr /c:" files: 0 written" %output%\unchanged.txt > nul || goto :failed
+%cppwinrt% -in local -out %output%\expected -rewrite -verbose > %output%\rewrite.txt || goto :failed
+findstr /c:" files: 0 written" %output%\rewrite.txt > nul && goto :failed
+
+rem The number of threads doesn't change the output.
+%cppwinrt% -in local -out %output%\synchronous -synchronous || goto :failed
+call :compare synchronous || goto :failed
+%cppwinrt% -in local -out %output%\jobs -jobs 3 || goto :failed
+call :compare jobs || goto :failed
+
+rem Profiling only adds the trace.
+%cppwinrt% -in local -out %output%\profile -profile %output%\profile.json || goto :failed
+if not exist %output%\profile.json goto :failed
+call :compare profile || goto :failed
+
+rem A winmd that is both an input and a reference is treated as an input.
+%cppwinrt% -in local -ref local -base -out %output%\reference || goto :failed
+call :compare reference || goto :failed
+
+rem The module graph is written alongside the headers.
+%cppwinrt% -in local -out %output%\graph -module_graph || goto :failed
+if not exist %output%\graph\winrt\winrt.modules.json goto :failed
+call :compare graph || goto :failed
+
+rem Splitting base.h writes each feature header.
+%cppwinrt% -in local -out %output%\split -split_base || goto :failed
+for %%s in (core events activation implements foundation coroutines) do if not exist %output%\split\winrt\base\%%s.h goto :failed
+
+rem A second incremental run skips every namespace and writes nothing.
+%cppwinrt% -in local -out %output%\incremental -incremental || goto :failed
+%cppwinrt% -in local -out %output%\incremental -incremental -verbose > %output%\incremental.txt || goto :failed
+findstr /c:" files: 0 written" %output%\incremental.txt > nul || goto :failed
+call :compare incremental || goto :failed
+
+rem Moving a winmd between -input and -reference regenerates the namespaces it affects.
+%cppwinrt% -in %foundation% -ref local -out %output%\moved -incremental || goto :failed
+%cppwinrt% -in local -out %output%\moved -incremental || goto :failed
+call :compare moved || goto :failed
+
+echo generator tests passed
+goto :eof
+
+:compare
+powershell -NoProfile -Command "function list($root) { Get-ChildItem -Recurse -File -Filter *.h $root | ForEach-Object { $_.FullName.Substring($root.Length) + ' ' + (Get-FileHash $_.FullName).Hash } }; $root = (Resolve-Path '%output%').Path; if (Compare-Object @(list \"$root\expected\") @(list \"$root\%1\")) { exit 1 }"
+if errorlevel 1 echo %1 differs from a plain run
+exit /b %errorlevel%
+
+:failed
+echo generator tests failed
+exit /b 1
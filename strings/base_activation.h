@@ -25,9 +25,127 @@ namespace winrt::impl
     }
 
 
+    // Maps class names to factory functions linked into the same binary. Each module has its own
+    // registry, and a later registration of the same name replaces an earlier one.
+    struct activation_registry
+    {
+        using factory_type = void* (*)();
+
+        activation_registry(activation_registry const&) = delete;
+        activation_registry& operator=(activation_registry const&) = delete;
+        activation_registry() noexcept = default;
+
+        ~activation_registry() noexcept
+        {
+            // Lookups from static destructors that run after this one fall back to the OS.
+            m_empty.store(true, std::memory_order_relaxed);
+
+            for (auto&& bucket : m_buckets)
+            {
+                for (entry* current = bucket.exchange(nullptr, std::memory_order_relaxed); current;)
+                {
+                    delete std::exchange(current, current->next);
+                }
+            }
+        }
+
+        void add(std::wstring_view const& name, factory_type factory)
+        {
+            uint32_t const hash = get_hash(name);
+            auto& bucket = m_buckets[hash % bucket_count];
+            auto value = new entry{ bucket.load(std::memory_order_relaxed), hash, factory, hstring{ name } };
+
+            while (!bucket.compare_exchange_weak(value->next, value, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+
+            m_empty.store(false, std::memory_order_release);
+        }
+
+        factory_type find(std::wstring_view const& name) const noexcept
+        {
+            if (m_empty.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+
+            uint32_t const hash = get_hash(name);
+
+            for (entry const* current = m_buckets[hash % bucket_count].load(std::memory_order_acquire); current; current = current->next)
+            {
+                if (current->hash == hash && current->name == name)
+                {
+                    return current->factory;
+                }
+            }
+
+            return nullptr;
+        }
+
+    private:
+
+        static constexpr uint32_t bucket_count{ 256 };
+
+        struct entry
+        {
+            entry* next;
+            uint32_t hash;
+            factory_type factory;
+            hstring name;
+        };
+
+        static uint32_t get_hash(std::wstring_view const& name) noexcept
+        {
+            uint32_t result = 2166136261;
+
+            for (wchar_t const c : name)
+            {
+                result = (result ^ c) * 16777619;
+            }
+
+            return result;
+        }
+
+        std::atomic<bool> m_empty{ true };
+        std::atomic<entry*> m_buckets[bucket_count]{};
+    };
+
+    inline activation_registry& get_activation_registry() noexcept
+    {
+        static activation_registry registry;
+        return registry;
+    }
+
     template <bool isSameInterfaceAsIActivationFactory>
     WINRT_IMPL_NOINLINE hresult get_runtime_activation_factory_impl(param::hstring const& name, winrt::guid const& guid, void** result) noexcept
     {
+        if (auto registered = get_activation_registry().find(static_cast<hstring const&>(name)))
+        {
+            com_ptr<abi_t<Windows::Foundation::IActivationFactory>> registered_factory;
+
+            try
+            {
+                *registered_factory.put_void() = registered();
+            }
+            catch (...)
+            {
+                return to_hresult();
+            }
+
+            if (registered_factory)
+            {
+                if constexpr (isSameInterfaceAsIActivationFactory)
+                {
+                    *result = registered_factory.detach();
+                    return 0;
+                }
+                else
+                {
+                    return registered_factory.as(guid, result);
+                }
+            }
+        }
+
         if (winrt_activation_handler)
         {
             return winrt_activation_handler(*(void**)(&name), guid, result);
@@ -264,6 +382,7 @@ namespace winrt::impl
 
         object_and_count m_value;
         alignas(memory_allocation_alignment) slist_entry m_next;
+        factory_cache_counters m_counters;
 
         void clear() noexcept
         {
@@ -281,6 +400,12 @@ namespace winrt::impl
             {
                 pointer_value->Release();
             }
+#ifdef WINRT_DIAGNOSTICS
+            else
+            {
+                m_counters.contention.fetch_add(1, std::memory_order_relaxed);
+            }
+#endif
 #else
             int64_t const result = _InterlockedCompareExchange64((int64_t*)this, 0, *(int64_t*)&current_value);
 
@@ -288,6 +413,12 @@ namespace winrt::impl
             {
                 pointer_value->Release();
             }
+#ifdef WINRT_DIAGNOSTICS
+            else
+            {
+                m_counters.contention.fetch_add(1, std::memory_order_relaxed);
+            }
+#endif
 #endif
         }
     };
@@ -342,7 +473,7 @@ namespace winrt::impl
         WINRT_IMPL_NOINLINE auto call(F&& callback)
         {
 #ifdef WINRT_DIAGNOSTICS
-            get_diagnostics_info().add_factory<Class>();
+            get_diagnostics_info().add_factory<Class>(m_counters);
 #endif
 
             auto object = get_activation_factory<Interface>(name_of<Class>());
@@ -364,6 +495,12 @@ namespace winrt::impl
                     *reinterpret_cast<void**>(&object) = nullptr;
                     get_factory_cache().add(this);
                 }
+#ifdef WINRT_DIAGNOSTICS
+                else
+                {
+                    m_counters.contention.fetch_add(1, std::memory_order_relaxed);
+                }
+#endif
 
                 return callback(*reinterpret_cast<com_ref<Interface> const*>(&m_value.object));
             }
@@ -383,6 +520,9 @@ namespace winrt::impl
 
             if (factory.m_value.object)
             {
+#ifdef WINRT_DIAGNOSTICS
+                factory.m_counters.hits.fetch_add(1, std::memory_order_relaxed);
+#endif
                 return callback(*reinterpret_cast<com_ref<Interface> const*>(&factory.m_value.object));
             }
         }
@@ -400,6 +540,9 @@ namespace winrt::impl
 
             if (factory.m_value.object)
             {
+#ifdef WINRT_DIAGNOSTICS
+                factory.m_counters.hits.fetch_add(1, std::memory_order_relaxed);
+#endif
                 return callback(*reinterpret_cast<com_ref<Interface> const*>(&factory.m_value.object));
             }
         }
@@ -428,6 +571,25 @@ namespace winrt::impl
         return { result, take_ownership_from_abi };
     }
 
+    template <typename Class>
+    void prewarm_factory() noexcept
+    {
+        try
+        {
+            call_factory<Class>([](auto&&) {});
+        }
+        catch (...)
+        {
+            // A class that cannot be activated is left for its first caller to report.
+        }
+    }
+
+    template <typename... Classes>
+    void __stdcall prewarm_factories_callback(void*, void*) noexcept
+    {
+        (prewarm_factory<Classes>(), ...);
+    }
+
     template <typename D> struct produce<D, Windows::Foundation::IActivationFactory> : produce_base<D, Windows::Foundation::IActivationFactory>
     {
         int32_t __stdcall ActivateInstance(void** instance) noexcept final try
@@ -505,6 +667,23 @@ WINRT_EXPORT namespace winrt
         impl::get_factory_cache().clear();
     }
 
+    // Registers a factory function for activation within the calling module. The function returns an owning
+    // IActivationFactory ABI pointer, or null to defer to the OS, so registering null removes a registration.
+    inline void register_activation_factory(std::wstring_view const& name, void* (*factory)())
+    {
+        impl::get_activation_registry().add(name, factory);
+    }
+
+    // Resolves and caches the activation factory of each class on the thread pool.
+    template <typename... Classes>
+    void prewarm_factories()
+    {
+        if (!WINRT_IMPL_TrySubmitThreadpoolCallback(impl::prewarm_factories_callback<Classes...>, nullptr, nullptr))
+        {
+            throw_last_error();
+        }
+    }
+
     template <typename Interface>
     auto try_create_instance(guid const& clsid, uint32_t context = 0x1 /*CLSCTX_INPROC_SERVER*/, void* outer = nullptr)
     {
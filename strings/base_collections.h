@@ -14,6 +14,42 @@ namespace winrt::impl
         return get_end_iterator(static_cast<D const&>(*this));
     }
 
+    // Maps create a key/value pair object for every element they enumerate and usually release it right
+    // away, so each thread keeps a few released blocks for reuse. A pool only holds blocks of one size.
+    template <typename T>
+    struct object_pool
+    {
+        static constexpr uint32_t max_cached{ 256 };
+
+        static void* allocate(std::size_t size)
+        {
+            if (void* block = get_cache().pop())
+            {
+                return block;
+            }
+
+            return ::operator new(size);
+        }
+
+        static void free(void* block) noexcept
+        {
+            get_cache().push(block);
+        }
+
+    private:
+
+        static void release(void* block) noexcept
+        {
+            ::operator delete(block);
+        }
+
+        static free_list<release, max_cached>& get_cache() noexcept
+        {
+            static thread_local free_list<release, max_cached> value;
+            return value;
+        }
+    };
+
     template <typename T>
     struct key_value_pair;
 
@@ -26,6 +62,17 @@ namespace winrt::impl
         {
         }
 
+        static void* operator new(std::size_t size)
+        {
+            WINRT_ASSERT(size == sizeof(heap_implements<key_value_pair>));
+            return object_pool<key_value_pair>::allocate(size);
+        }
+
+        static void operator delete(void* block) noexcept
+        {
+            object_pool<key_value_pair>::free(block);
+        }
+
         K Key() const
         {
             return m_key;
@@ -42,6 +89,158 @@ namespace winrt::impl
         V const m_value;
     };
 
+    // Lets in-process consumers visit the elements of this library's maps without creating a pair
+    // object for each. The callback may return an error to stop early.
+    template <typename K, typename V>
+    struct __declspec(novtable) IMapVisitor : unknown_abi
+    {
+        virtual int32_t __stdcall Visit(int32_t(__stdcall* callback)(void* context, K const& key, V const& value) noexcept, void* context) noexcept = 0;
+    };
+
+    template <typename K, typename V> struct category<IMapVisitor<K, V>> { using type = generic_category<K, V>; };
+    template <typename K, typename V> inline constexpr guid generic_guid_v<IMapVisitor<K, V>>{ 0x53fdec12, 0x3012, 0x46ff, { 0xb9,0xce,0xdd,0x1d,0x1f,0xf4,0x9e,0xee } };
+    template <typename K, typename V> inline constexpr guid guid_v<IMapVisitor<K, V>>{ pinterface_guid<IMapVisitor<K, V>>::value };
+
+    struct nop_lock_guard;
+
+    // Handed out as a tearoff by the map implementations. Visiting stops if the map changes. The
+    // callback may use the map, so multi-threaded maps are visited through copies made under the lock.
+    template <typename D, typename K, typename V>
+    struct map_visitor final : IMapVisitor<K, V>
+    {
+        explicit map_visitor(D const& owner) noexcept :
+            m_owner(owner),
+            m_view(owner)
+        {
+        }
+
+        int32_t __stdcall QueryInterface(guid const& id, void** object) noexcept final
+        {
+            if (is_guid_of<IMapVisitor<K, V>>(id))
+            {
+                *object = static_cast<IMapVisitor<K, V>*>(this);
+                AddRef();
+                return error_ok;
+            }
+
+            return static_cast<unknown_abi*>(get_abi(m_view))->QueryInterface(id, object);
+        }
+
+        uint32_t __stdcall AddRef() noexcept final
+        {
+            return 1 + m_references.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        uint32_t __stdcall Release() noexcept final
+        {
+            uint32_t const remaining = m_references.fetch_sub(1, std::memory_order_release) - 1;
+
+            if (remaining == 0)
+            {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                delete this;
+            }
+
+            return remaining;
+        }
+
+        int32_t __stdcall Visit(int32_t(__stdcall* callback)(void* context, K const& key, V const& value) noexcept, void* context) noexcept final try
+        {
+            auto const& container = m_owner.get_container();
+
+            if constexpr (std::is_same_v<decltype(m_owner.acquire_shared()), nop_lock_guard>)
+            {
+                uint32_t const version = m_owner.get_version();
+
+                for (auto&& [key, value] : container)
+                {
+                    if (int32_t const result = callback(context, m_owner.unwrap_value(key), m_owner.unwrap_value(value)))
+                    {
+                        return result;
+                    }
+
+                    if (m_owner.get_version() != version)
+                    {
+                        return error_changed_state;
+                    }
+                }
+            }
+            else
+            {
+                std::vector<std::pair<K, V>> batch;
+                batch.reserve(batch_size);
+                uint32_t version{};
+                decltype(container.begin()) position{};
+
+                {
+                    auto guard = m_owner.acquire_shared();
+                    version = m_owner.get_version();
+                    position = container.begin();
+                }
+
+                for (;;)
+                {
+                    batch.clear();
+
+                    {
+                        auto guard = m_owner.acquire_shared();
+
+                        if (m_owner.get_version() != version)
+                        {
+                            return error_changed_state;
+                        }
+
+                        for (; position != container.end() && batch.size() < batch_size; ++position)
+                        {
+                            batch.emplace_back(m_owner.unwrap_value(position->first), m_owner.unwrap_value(position->second));
+                        }
+                    }
+
+                    if (batch.empty())
+                    {
+                        break;
+                    }
+
+                    for (auto&& [key, value] : batch)
+                    {
+                        if (int32_t const result = callback(context, key, value))
+                        {
+                            return result;
+                        }
+
+                        if (m_owner.get_version() != version)
+                        {
+                            return error_changed_state;
+                        }
+                    }
+                }
+            }
+
+            return error_ok;
+        }
+        catch (...) { return to_hresult(); }
+
+    private:
+
+        static constexpr std::size_t batch_size{ 64 };
+
+        D const& m_owner;
+        wfc::IMapView<K, V> const m_view;
+        std::atomic<uint32_t> m_references{ 1 };
+    };
+
+    template <typename K, typename V, typename D>
+    int32_t query_map_visitor(D const& owner, guid const& id, void** object) noexcept
+    {
+        if (!is_guid_of<IMapVisitor<K, V>>(id))
+        {
+            return error_no_interface;
+        }
+
+        *object = static_cast<IMapVisitor<K, V>*>(new (std::nothrow) map_visitor<D, K, V>(owner));
+        return *object ? error_ok : error_bad_alloc;
+    }
+
     template <typename T>
     struct is_key_value_pair : std::false_type {};
 
@@ -119,6 +318,24 @@ namespace winrt::impl
         std::atomic<uint32_t> m_version{};
     };
 
+    // Views over part of another collection validate its version rather than keeping their own.
+    struct range_version
+    {
+        struct iterator_type
+        {
+            template <typename D>
+            iterator_type(D const&) noexcept
+            {
+            }
+
+            template <typename D>
+            void check_version(D const& range) const
+            {
+                range.check_version();
+            }
+        };
+    };
+
     template <typename T>
     struct range_container
     {
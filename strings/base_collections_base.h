@@ -35,6 +35,12 @@ namespace winrt::impl
     template <typename D>
     using container_type_t = std::decay_t<decltype(std::declval<D>().get_container())>;
 
+    template <typename Container, typename = void>
+    struct is_ordered_container : std::false_type {};
+
+    template <typename Container>
+    struct is_ordered_container<Container, std::void_t<typename Container::key_compare>> : std::true_type {};
+
     template <typename D, typename = void>
     struct removed_values
     {
@@ -531,11 +537,158 @@ WINRT_EXPORT namespace winrt
             return static_cast<D const&>(*this).get_container().find(static_cast<D const&>(*this).wrap_value(key)) != static_cast<D const&>(*this).get_container().end();
         }
 
-        void Split(Windows::Foundation::Collections::IMapView<K, V>& first, Windows::Foundation::Collections::IMapView<K, V>& second) const noexcept
+        void Split(Windows::Foundation::Collections::IMapView<K, V>& first, Windows::Foundation::Collections::IMapView<K, V>& second) const
+        {
+            // Splits are only safe over ordered maps whose changes are tracked by a version.
+            if constexpr (impl::is_ordered_container<impl::container_type_t<D>>::value && std::is_base_of_v<impl::collection_version, D>)
+            {
+                auto guard = static_cast<D const&>(*this).acquire_shared();
+                auto& container = static_cast<D const&>(*this).get_container();
+                split(static_cast<D const&>(*this), container.begin(), container.end(), static_cast<uint32_t>(container.size()), first, second);
+            }
+            else
+            {
+                first = nullptr;
+                second = nullptr;
+            }
+        }
+
+    private:
+
+        // Ordered maps are split into views over adjacent halves that are invalidated if the map changes.
+        template <typename Iterator>
+        static void split(D const& owner, Iterator const low, Iterator const high, uint32_t const size, Windows::Foundation::Collections::IMapView<K, V>& first, Windows::Foundation::Collections::IMapView<K, V>& second)
         {
             first = nullptr;
             second = nullptr;
+
+            if (size < 2)
+            {
+                return;
+            }
+
+            auto const middle = std::next(low, size / 2);
+            first = make<range>(owner, low, middle, size / 2);
+            second = make<range>(owner, middle, high, size - size / 2);
         }
+
+        struct range :
+            implements<range, Windows::Foundation::Collections::IMapView<K, V>, Windows::Foundation::Collections::IIterable<Windows::Foundation::Collections::IKeyValuePair<K, V>>>,
+            iterable_base<range, Windows::Foundation::Collections::IKeyValuePair<K, V>, impl::range_version>
+        {
+            using container_iterator = decltype(std::declval<D const&>().get_container().begin());
+
+            range(D const& owner, container_iterator const first, container_iterator const last, uint32_t const size) noexcept :
+                m_first(first),
+                m_last(last),
+                m_size(size),
+                m_version(owner.get_version())
+            {
+                m_owner.copy_from(const_cast<D*>(&owner));
+            }
+
+            void abi_enter() const
+            {
+                m_owner->abi_enter();
+            }
+
+            void abi_exit() const
+            {
+                m_owner->abi_exit();
+            }
+
+            auto acquire_exclusive() const
+            {
+                return m_owner->acquire_exclusive();
+            }
+
+            auto acquire_shared() const
+            {
+                return m_owner->acquire_shared();
+            }
+
+            template <typename U>
+            decltype(auto) unwrap_value(U const& value) const
+            {
+                return m_owner->unwrap_value(value);
+            }
+
+            auto get_container() const noexcept
+            {
+                return impl::range_container<container_iterator>{ m_first, m_last };
+            }
+
+            void check_version() const
+            {
+                if (m_owner->get_version() != m_version)
+                {
+                    throw hresult_changed_state();
+                }
+            }
+
+            V Lookup(K const& key) const
+            {
+                auto guard = acquire_shared();
+                check_version();
+                auto pair = find(key);
+
+                if (pair == m_last)
+                {
+                    throw hresult_out_of_bounds();
+                }
+
+                return m_owner->unwrap_value(pair->second);
+            }
+
+            uint32_t Size() const
+            {
+                auto guard = acquire_shared();
+                check_version();
+                return m_size;
+            }
+
+            bool HasKey(K const& key) const
+            {
+                auto guard = acquire_shared();
+                check_version();
+                return find(key) != m_last;
+            }
+
+            void Split(Windows::Foundation::Collections::IMapView<K, V>& first, Windows::Foundation::Collections::IMapView<K, V>& second) const
+            {
+                auto guard = acquire_shared();
+                check_version();
+                split(*m_owner, m_first, m_last, m_size, first, second);
+            }
+
+        private:
+
+            container_iterator find(K const& key) const
+            {
+                auto& container = static_cast<D const&>(*m_owner).get_container();
+                auto pair = container.find(m_owner->wrap_value(key));
+
+                if (pair == container.end())
+                {
+                    return m_last;
+                }
+
+                auto const compare = container.key_comp();
+
+                if (compare(pair->first, m_first->first) || (m_last != container.end() && !compare(pair->first, m_last->first)))
+                {
+                    return m_last;
+                }
+
+                return pair;
+            }
+
+            com_ptr<D> m_owner;
+            container_iterator const m_first;
+            container_iterator const m_last;
+            uint32_t const m_size;
+            uint32_t const m_version;
+        };
     };
 
     template <typename D, typename K, typename V>
@@ -653,3 +806,215 @@ WINRT_EXPORT namespace winrt
         };
     };
 }
+
+namespace winrt::impl
+{
+    // Counts the readers of one snapshot collection across several cache lines, in two generations so
+    // that a writer only waits for readers that arrived before it.
+    struct snapshot_readers
+    {
+        static constexpr uint32_t slot_count{ 16 };
+
+        uint32_t enter() noexcept
+        {
+            uint32_t const generation = m_generation.load() & 1;
+            get_slot().counts[generation].fetch_add(1);
+            return generation;
+        }
+
+        void leave(uint32_t const generation) noexcept
+        {
+            get_slot().counts[generation].fetch_sub(1, std::memory_order_release);
+        }
+
+        void synchronize() noexcept
+        {
+            slim_lock_guard const guard(m_lock);
+
+            // The second round covers readers that read the generation just before it was flipped.
+            for (uint32_t round = 0; round < 2; ++round)
+            {
+                uint32_t const previous = m_generation.fetch_add(1) & 1;
+
+                for (auto&& slot : m_slots)
+                {
+                    while (slot.counts[previous].load(std::memory_order_acquire) != 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+    private:
+
+        struct alignas(64) slot
+        {
+            std::atomic<uint32_t> counts[2]{};
+        };
+
+        slot& get_slot() noexcept
+        {
+            static std::atomic<uint32_t> next{};
+            thread_local uint32_t const index = next.fetch_add(1, std::memory_order_relaxed) % slot_count;
+            return m_slots[index];
+        }
+
+        slim_mutex m_lock;
+        std::atomic<uint32_t> m_generation{};
+        slot m_slots[slot_count];
+    };
+
+    // Gives each iterator its own lock so that iterators over the same snapshot don't contend.
+    template <typename Snapshot, typename T>
+    struct snapshot_iterable :
+        implements<snapshot_iterable<Snapshot, T>, wfc::IIterable<T>>,
+        iterable_base<snapshot_iterable<Snapshot, T>, T>,
+        multi_threaded_collection_base
+    {
+        explicit snapshot_iterable(com_ptr<Snapshot>&& snapshot) noexcept : m_snapshot(std::move(snapshot))
+        {
+        }
+
+        auto& get_container() const noexcept
+        {
+            return m_snapshot->get_container();
+        }
+
+        using multi_threaded_collection_base::acquire_shared;
+        using multi_threaded_collection_base::acquire_exclusive;
+
+    private:
+
+        com_ptr<Snapshot> const m_snapshot;
+    };
+
+    // Readers use the current snapshot without a lock while writers publish a changed copy of it.
+    // Iterators keep the snapshot that was current when they were created.
+    template <typename Snapshot>
+    struct snapshot_collection_base
+    {
+        template <typename Container>
+        explicit snapshot_collection_base(Container&& values) :
+            m_snapshot(make_self<Snapshot>(std::forward<Container>(values)).detach())
+        {
+        }
+
+        ~snapshot_collection_base() noexcept
+        {
+            com_ptr<Snapshot> snapshot;
+            snapshot.attach(m_snapshot.load(std::memory_order_relaxed));
+        }
+
+    protected:
+
+        struct reader
+        {
+            reader(snapshot_readers& readers, std::atomic<Snapshot*> const& snapshot) noexcept :
+                m_readers(readers),
+                m_generation(readers.enter()),
+                m_snapshot(snapshot.load())
+            {
+            }
+
+            ~reader() noexcept
+            {
+                m_readers.leave(m_generation);
+            }
+
+            reader(reader const&) = delete;
+            reader& operator=(reader const&) = delete;
+
+            Snapshot* get() const noexcept
+            {
+                return m_snapshot;
+            }
+
+            Snapshot* operator->() const noexcept
+            {
+                return m_snapshot;
+            }
+
+        private:
+
+            snapshot_readers& m_readers;
+            uint32_t const m_generation;
+            Snapshot* const m_snapshot;
+        };
+
+        [[nodiscard]] reader acquire_snapshot() const noexcept
+        {
+            return reader{ m_readers, m_snapshot };
+        }
+
+        template <typename T>
+        auto first() const
+        {
+            com_ptr<Snapshot> snapshot;
+
+            {
+                auto current = acquire_snapshot();
+                snapshot.copy_from(current.get());
+            }
+
+            return make_self<snapshot_iterable<Snapshot, T>>(std::move(snapshot))->First();
+        }
+
+        template <typename F>
+        auto update(F&& change)
+        {
+            retired_snapshot retired{ m_readers };
+            slim_lock_guard const guard(m_lock);
+            auto values = m_snapshot.load(std::memory_order_relaxed)->get_container();
+
+            if constexpr (std::is_void_v<decltype(change(values))>)
+            {
+                change(values);
+                retired.value = publish(std::move(values));
+            }
+            else
+            {
+                auto result = change(values);
+                retired.value = publish(std::move(values));
+                return result;
+            }
+        }
+
+        template <typename Container>
+        void reset(Container&& values)
+        {
+            retired_snapshot retired{ m_readers };
+            slim_lock_guard const guard(m_lock);
+            retired.value = publish(std::forward<Container>(values));
+        }
+
+    private:
+
+        // Released after the writer's lock once no reader can still see it.
+        struct retired_snapshot
+        {
+            snapshot_readers& readers;
+            com_ptr<Snapshot> value;
+
+            ~retired_snapshot() noexcept
+            {
+                if (value)
+                {
+                    readers.synchronize();
+                }
+            }
+        };
+
+        template <typename Container>
+        com_ptr<Snapshot> publish(Container&& values)
+        {
+            com_ptr<Snapshot> previous;
+            previous.attach(m_snapshot.exchange(make_self<Snapshot>(std::forward<Container>(values)).detach()));
+            return previous;
+        }
+
+        slim_mutex m_lock;
+        std::atomic<Snapshot*> m_snapshot;
+        mutable snapshot_readers m_readers;
+    };
+}
@@ -28,6 +28,11 @@ namespace winrt::impl
 
     private:
 
+        int32_t query_interface_tearoff(guid const& id, void** object) const noexcept override
+        {
+            return query_map_visitor<K, V>(*this, id, object);
+        }
+
         Container m_values;
     };
 
@@ -31,6 +31,11 @@ namespace winrt::impl
 
     private:
 
+        int32_t query_interface_tearoff(guid const& id, void** object) const noexcept override
+        {
+            return query_map_visitor<K, V>(*this, id, object);
+        }
+
         Container m_values;
     };
 
@@ -39,6 +44,236 @@ namespace winrt::impl
 
     template <typename K, typename V, typename Container>
     using multi_threaded_observable_map = observable_map_impl<K, V, Container, multi_threaded_collection_base>;
+
+    template <typename K, typename V, typename Container>
+    struct snapshot_map :
+        implements<snapshot_map<K, V, Container>, wfc::IMap<K, V>, wfc::IMapView<K, V>, wfc::IIterable<wfc::IKeyValuePair<K, V>>>,
+        snapshot_collection_base<input_map_view<K, V, Container>>
+    {
+        static_assert(std::is_same_v<Container, std::remove_reference_t<Container>>, "Must be constructed with rvalue.");
+
+        explicit snapshot_map(Container&& values) :
+            snapshot_collection_base<input_map_view<K, V, Container>>(std::forward<Container>(values))
+        {
+        }
+
+        auto First() const
+        {
+            return this->template first<wfc::IKeyValuePair<K, V>>();
+        }
+
+        V Lookup(K const& key) const
+        {
+            auto snapshot = this->acquire_snapshot();
+            return snapshot->Lookup(key);
+        }
+
+        uint32_t Size() const noexcept
+        {
+            auto snapshot = this->acquire_snapshot();
+            return snapshot->Size();
+        }
+
+        bool HasKey(K const& key) const noexcept
+        {
+            auto snapshot = this->acquire_snapshot();
+            return snapshot->HasKey(key);
+        }
+
+        void Split(wfc::IMapView<K, V>& first, wfc::IMapView<K, V>& second) const
+        {
+            // The halves refer to the snapshot and so are never invalidated by changes.
+            auto snapshot = this->acquire_snapshot();
+            snapshot->Split(first, second);
+        }
+
+        wfc::IMapView<K, V> GetView() const
+        {
+            return *this;
+        }
+
+        bool Insert(K const& key, V const& value)
+        {
+            return this->update([&](Container& values)
+            {
+                return !values.insert_or_assign(key, value).second;
+            });
+        }
+
+        void Remove(K const& key)
+        {
+            this->update([&](Container& values)
+            {
+                if (values.erase(key) == 0)
+                {
+                    throw hresult_out_of_bounds();
+                }
+            });
+        }
+
+        void Clear()
+        {
+            this->reset(Container{});
+        }
+    };
+
+    template <typename K, typename V, typename F>
+    struct map_visit_context
+    {
+        F& callback;
+        std::exception_ptr failure{};
+
+        static int32_t __stdcall invoke(void* context, K const& key, V const& value) noexcept
+        {
+            auto self = static_cast<map_visit_context*>(context);
+
+            try
+            {
+                self->callback(key, value);
+                return error_ok;
+            }
+            catch (...)
+            {
+                self->failure = std::current_exception();
+                return error_fail;
+            }
+        }
+    };
+
+    template <typename K, typename V, typename Map, typename F>
+    void for_each_pair(Map const& map, F& callback)
+    {
+        if (auto visitor = map.template try_as<IMapVisitor<K, V>>())
+        {
+            map_visit_context<K, V, F> context{ callback };
+            int32_t const result = visitor->Visit(map_visit_context<K, V, F>::invoke, &context);
+
+            if (context.failure)
+            {
+                std::rethrow_exception(context.failure);
+            }
+
+            check_hresult(result);
+        }
+        else
+        {
+            for (auto&& pair : map)
+            {
+                callback(pair.Key(), pair.Value());
+            }
+        }
+    }
+
+    // Splits a map view until the parts are no larger than the grain and walks them on the thread pool.
+    template <typename K, typename V, typename F>
+    struct parallel_map_walker : std::enable_shared_from_this<parallel_map_walker<K, V, F>>
+    {
+        parallel_map_walker(F const& callback, uint32_t const grain) noexcept :
+            m_callback(callback),
+            m_grain(grain)
+        {
+        }
+
+        void walk(wfc::IMapView<K, V> view) noexcept
+        {
+            try
+            {
+                while (!m_failed && view.Size() > m_grain)
+                {
+                    wfc::IMapView<K, V> first;
+                    wfc::IMapView<K, V> second;
+                    view.Split(first, second);
+
+                    if (!first || !second)
+                    {
+                        break;
+                    }
+
+                    submit(std::move(second));
+                    view = std::move(first);
+                }
+
+                if (!m_failed)
+                {
+                    for (auto&& pair : view)
+                    {
+                        m_callback(pair);
+                    }
+                }
+            }
+            catch (...)
+            {
+                slim_lock_guard const guard(m_lock);
+
+                if (!m_failure)
+                {
+                    m_failure = std::current_exception();
+                }
+
+                m_failed = true;
+            }
+        }
+
+        void wait()
+        {
+            {
+                slim_lock_guard const guard(m_lock);
+                m_done.wait(m_lock, [&] { return m_pending == 0; });
+            }
+
+            if (m_failure)
+            {
+                std::rethrow_exception(m_failure);
+            }
+        }
+
+    private:
+
+        using work_type = std::pair<std::shared_ptr<parallel_map_walker>, wfc::IMapView<K, V>>;
+
+        void submit(wfc::IMapView<K, V>&& view)
+        {
+            auto work = std::make_unique<work_type>(this->shared_from_this(), std::move(view));
+
+            {
+                slim_lock_guard const guard(m_lock);
+                ++m_pending;
+            }
+
+            if (!WINRT_IMPL_TrySubmitThreadpoolCallback(callback, work.get(), nullptr))
+            {
+                complete();
+                throw_last_error();
+            }
+
+            work.release();
+        }
+
+        void complete() noexcept
+        {
+            slim_lock_guard const guard(m_lock);
+
+            if (--m_pending == 0)
+            {
+                m_done.notify_all();
+            }
+        }
+
+        static void __stdcall callback(void*, void* context) noexcept
+        {
+            std::unique_ptr<work_type> work(static_cast<work_type*>(context));
+            work->first->walk(std::move(work->second));
+            work->first->complete();
+        }
+
+        F const& m_callback;
+        uint32_t const m_grain;
+        std::atomic<bool> m_failed{};
+        slim_mutex m_lock;
+        slim_condition_variable m_done;
+        uint32_t m_pending{};
+        std::exception_ptr m_failure;
+    };
 }
 
 WINRT_EXPORT namespace winrt
@@ -79,6 +314,25 @@ WINRT_EXPORT namespace winrt
         return make<impl::multi_threaded_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>>>(std::move(values));
     }
 
+    // Suits maps that are shared by many threads and rarely changed, since every change copies the map.
+    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    Windows::Foundation::Collections::IMap<K, V> multi_threaded_snapshot_map()
+    {
+        return make<impl::snapshot_map<K, V, std::map<K, V, Compare, Allocator>>>(std::map<K, V, Compare, Allocator>{});
+    }
+
+    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    Windows::Foundation::Collections::IMap<K, V> multi_threaded_snapshot_map(std::map<K, V, Compare, Allocator>&& values)
+    {
+        return make<impl::snapshot_map<K, V, std::map<K, V, Compare, Allocator>>>(std::move(values));
+    }
+
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    Windows::Foundation::Collections::IMap<K, V> multi_threaded_snapshot_map(std::unordered_map<K, V, Hash, KeyEqual, Allocator>&& values)
+    {
+        return make<impl::snapshot_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>>>(std::move(values));
+    }
+
     template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
     Windows::Foundation::Collections::IObservableMap<K, V> single_threaded_observable_map()
     {
@@ -114,6 +368,36 @@ WINRT_EXPORT namespace winrt
     {
         return make<impl::multi_threaded_observable_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>>>(std::move(values));
     }
+
+    // Calls the callback with every key and value, without a pair object per element for this library's
+    // maps. Multi-threaded maps aren't locked while it runs, but any change stops the visit.
+    template <typename K, typename V, typename F>
+    void for_each_pair(Windows::Foundation::Collections::IMapView<K, V> const& map, F&& callback)
+    {
+        impl::for_each_pair<K, V>(map, callback);
+    }
+
+    template <typename K, typename V, typename F>
+    void for_each_pair(Windows::Foundation::Collections::IMap<K, V> const& map, F&& callback)
+    {
+        impl::for_each_pair<K, V>(map, callback);
+    }
+
+    // Calls the callback concurrently for the pairs in parts of the map no larger than grain, rethrowing
+    // the first exception once all of the work has finished. Maps that can't be split are walked in place.
+    template <typename K, typename V, typename F>
+    void parallel_for_each(Windows::Foundation::Collections::IMapView<K, V> const& map, F const& callback, uint32_t const grain = 1024)
+    {
+        auto walker = std::make_shared<impl::parallel_map_walker<K, V, F>>(callback, grain);
+        walker->walk(map);
+        walker->wait();
+    }
+
+    template <typename K, typename V, typename F>
+    void parallel_for_each(Windows::Foundation::Collections::IMap<K, V> const& map, F const& callback, uint32_t const grain = 1024)
+    {
+        parallel_for_each(map.GetView(), callback, grain);
+    }
 }
 
 namespace std
@@ -284,6 +284,123 @@ namespace winrt::impl
 
     template <typename T, typename Container>
     using multi_threaded_convertible_observable_vector = convertible_observable_vector<T, Container, multi_threaded_collection_base>;
+
+    template <typename T, typename Container>
+    struct snapshot_vector :
+        implements<snapshot_vector<T, Container>, wfc::IVector<T>, wfc::IVectorView<T>, wfc::IIterable<T>>,
+        snapshot_collection_base<input_vector_view<T, Container>>
+    {
+        static_assert(std::is_same_v<Container, std::remove_reference_t<Container>>, "Must be constructed with rvalue.");
+
+        explicit snapshot_vector(Container&& values) :
+            snapshot_collection_base<input_vector_view<T, Container>>(std::forward<Container>(values))
+        {
+        }
+
+        auto First() const
+        {
+            return this->template first<T>();
+        }
+
+        T GetAt(uint32_t const index) const
+        {
+            auto snapshot = this->acquire_snapshot();
+            return snapshot->GetAt(index);
+        }
+
+        uint32_t Size() const noexcept
+        {
+            auto snapshot = this->acquire_snapshot();
+            return snapshot->Size();
+        }
+
+        bool IndexOf(T const& value, uint32_t& index) const noexcept
+        {
+            auto snapshot = this->acquire_snapshot();
+            return snapshot->IndexOf(value, index);
+        }
+
+        uint32_t GetMany(uint32_t const startIndex, array_view<T> values) const
+        {
+            auto snapshot = this->acquire_snapshot();
+            return snapshot->GetMany(startIndex, values);
+        }
+
+        wfc::IVectorView<T> GetView() const noexcept
+        {
+            return *this;
+        }
+
+        void SetAt(uint32_t const index, T const& value)
+        {
+            this->update([&](Container& values)
+            {
+                if (index >= values.size())
+                {
+                    throw hresult_out_of_bounds();
+                }
+
+                values[index] = value;
+            });
+        }
+
+        void InsertAt(uint32_t const index, T const& value)
+        {
+            this->update([&](Container& values)
+            {
+                if (index > values.size())
+                {
+                    throw hresult_out_of_bounds();
+                }
+
+                values.insert(values.begin() + index, value);
+            });
+        }
+
+        void RemoveAt(uint32_t const index)
+        {
+            this->update([&](Container& values)
+            {
+                if (index >= values.size())
+                {
+                    throw hresult_out_of_bounds();
+                }
+
+                values.erase(values.begin() + index);
+            });
+        }
+
+        void Append(T const& value)
+        {
+            this->update([&](Container& values)
+            {
+                values.push_back(value);
+            });
+        }
+
+        void RemoveAtEnd()
+        {
+            this->update([&](Container& values)
+            {
+                if (values.empty())
+                {
+                    throw hresult_out_of_bounds();
+                }
+
+                values.pop_back();
+            });
+        }
+
+        void Clear()
+        {
+            this->reset(Container{});
+        }
+
+        void ReplaceAll(array_view<T const> value)
+        {
+            this->reset(Container(value.begin(), value.end()));
+        }
+    };
 }
 
 WINRT_EXPORT namespace winrt
@@ -300,6 +417,13 @@ WINRT_EXPORT namespace winrt
         return make<impl::multi_threaded_vector<T, std::vector<T, Allocator>>>(std::move(values));
     }
 
+    // Suits vectors that are shared by many threads and rarely changed, since every change copies the vector.
+    template <typename T, typename Allocator = std::allocator<T>>
+    Windows::Foundation::Collections::IVector<T> multi_threaded_snapshot_vector(std::vector<T, Allocator>&& values = {})
+    {
+        return make<impl::snapshot_vector<T, std::vector<T, Allocator>>>(std::move(values));
+    }
+
     template <typename T, typename Allocator = std::allocator<T>>
     Windows::Foundation::Collections::IObservableVector<T> single_threaded_observable_vector(std::vector<T, Allocator>&& values = {})
     {
@@ -378,127 +378,324 @@ WINRT_EXPORT namespace winrt
         event(event<Delegate> const&) = delete;
         event<Delegate>& operator =(event<Delegate> const&) = delete;
 
+        ~event() noexcept
+        {
+            release_targets(m_targets.load(std::memory_order_relaxed));
+        }
+
         explicit operator bool() const noexcept
         {
-            return m_targets != nullptr;
+            return m_targets.load(std::memory_order_relaxed) != nullptr;
         }
 
         event_token add(delegate_type const& delegate)
         {
             event_token token{};
-
-            // Extends life of old targets array to release delegates outside of lock.
-            delegate_array temp_targets;
+            void* temp_targets{};
 
             {
                 slim_lock_guard const change_guard(m_change);
-                delegate_array new_targets = impl::make_event_array<delegate_type>((!m_targets) ? 1 : m_targets->size() + 1);
+                auto const targets = m_targets.load(std::memory_order_relaxed);
+                delegate_type new_delegate = impl::make_agile_delegate(delegate);
+                token = get_token(new_delegate);
 
-                if (m_targets)
+                if (!targets)
                 {
-                    std::copy_n(m_targets->begin(), m_targets->size(), new_targets->begin());
+                    temp_targets = exchange_targets(to_single(detach_abi(new_delegate)));
+                }
+                else if (is_single(targets))
+                {
+                    delegate_array new_targets = impl::make_event_array<delegate_type>(2);
+                    copy_from_abi(*new_targets->begin(), from_single(targets));
+                    new_targets->back() = std::move(new_delegate);
+                    temp_targets = exchange_targets(new_targets.detach());
+                }
+                else
+                {
+                    auto const array = to_array(targets);
+                    delegate_array new_targets = impl::make_event_array<delegate_type>(array->size() + 1);
+                    std::copy_n(array->begin(), array->size(), new_targets->begin());
+                    new_targets->back() = std::move(new_delegate);
+                    temp_targets = exchange_targets(new_targets.detach());
                 }
-
-                new_targets->back() = impl::make_agile_delegate(delegate);
-                token = get_token(new_targets->back());
-
-                slim_lock_guard const swap_guard(m_swap);
-                temp_targets = std::exchange(m_targets, std::move(new_targets));
             }
 
+            // Releases the old targets outside of lock.
+            release_targets(temp_targets);
             return token;
         }
 
         void remove(event_token const token)
         {
-            // Extends life of old targets array to release delegates outside of lock.
-            delegate_array temp_targets;
+            void* temp_targets{};
 
             {
                 slim_lock_guard const change_guard(m_change);
+                auto const targets = m_targets.load(std::memory_order_relaxed);
 
-                if (!m_targets)
+                if (!targets)
                 {
                     return;
                 }
 
-                uint32_t available_slots = m_targets->size() - 1;
-                delegate_array new_targets;
-                bool removed = false;
-
-                if (available_slots == 0)
+                if (is_single(targets))
                 {
-                    if (get_token(*m_targets->begin()) == token)
+                    if (get_token(from_single(targets)) != token)
                     {
-                        removed = true;
+                        return;
                     }
+
+                    temp_targets = exchange_targets(nullptr);
                 }
                 else
                 {
-                    new_targets = impl::make_event_array<delegate_type>(available_slots);
-                    auto new_iterator = new_targets->begin();
+                    auto const array = to_array(targets);
+                    auto const begin = array->begin();
+                    auto const end = array->end();
+
+                    auto const found = std::find_if(begin, end, [&](delegate_type const& element)
+                    {
+                        return get_token(element) == token;
+                    });
 
-                    for (delegate_type const& element : *m_targets)
+                    if (found == end)
                     {
-                        if (!removed && token == get_token(element))
-                        {
-                            removed = true;
-                            continue;
-                        }
-
-                        if (available_slots == 0)
-                        {
-                            WINRT_ASSERT(!removed);
-                            break;
-                        }
-
-                        *new_iterator = element;
-                        ++new_iterator;
-                        --available_slots;
+                        return;
                     }
-                }
 
-                if (removed)
-                {
-                    slim_lock_guard const swap_guard(m_swap);
-                    temp_targets = std::exchange(m_targets, std::move(new_targets));
+                    if (array->size() == 2)
+                    {
+                        delegate_type remaining = (found == begin) ? *(begin + 1) : *begin;
+                        temp_targets = exchange_targets(to_single(detach_abi(remaining)));
+                    }
+                    else
+                    {
+                        delegate_array new_targets = impl::make_event_array<delegate_type>(array->size() - 1);
+                        std::copy(found + 1, end, std::copy(begin, found, new_targets->begin()));
+                        temp_targets = exchange_targets(new_targets.detach());
+                    }
                 }
             }
+
+            // Releases the old targets outside of lock.
+            release_targets(temp_targets);
         }
 
         template<typename...Arg>
         void operator()(Arg const&... args)
         {
-            delegate_array temp_targets;
+            auto const targets = acquire_targets();
 
+            if (!targets)
             {
-                slim_lock_guard const swap_guard(m_swap);
-                temp_targets = m_targets;
+                return;
             }
 
-            if (temp_targets)
+            if (is_single(targets))
             {
+                delegate_type single;
+                attach_abi(single, from_single(targets));
+
+                if (!impl::invoke(single, args...))
+                {
+                    remove(get_token(single));
+                }
+            }
+            else
+            {
+                delegate_array temp_targets;
+                temp_targets.attach(to_array(targets));
+                std::vector<event_token> disconnected;
+
                 for (delegate_type const& element : *temp_targets)
                 {
                     if (!impl::invoke(element, args...))
                     {
-                        remove(get_token(element));
+                        disconnected.push_back(get_token(element));
                     }
                 }
+
+                if (!disconnected.empty())
+                {
+                    remove_disconnected(disconnected);
+                }
             }
         }
 
     private:
 
+        event_token get_token(void* delegate) const noexcept
+        {
+            return event_token{ reinterpret_cast<int64_t>(WINRT_IMPL_EncodePointer(delegate)) };
+        }
+
         event_token get_token(delegate_type const& delegate) const noexcept
         {
-            return event_token{ reinterpret_cast<int64_t>(WINRT_IMPL_EncodePointer(get_abi(delegate))) };
+            return get_token(get_abi(delegate));
         }
 
         using delegate_array = com_ptr<impl::event_array<delegate_type>>;
 
-        delegate_array m_targets;
-        slim_mutex m_swap;
+        // Removes the handlers that reported disconnection with a single update of the targets.
+        void remove_disconnected(std::vector<event_token>& tokens)
+        {
+            auto const less = [](event_token const& left, event_token const& right) noexcept
+            {
+                return left.value < right.value;
+            };
+
+            std::sort(tokens.begin(), tokens.end(), less);
+
+            auto const connected = [&](event_token const& token) noexcept
+            {
+                return !std::binary_search(tokens.begin(), tokens.end(), token, less);
+            };
+
+            void* temp_targets{};
+
+            {
+                slim_lock_guard const change_guard(m_change);
+                auto const targets = m_targets.load(std::memory_order_relaxed);
+
+                if (!targets)
+                {
+                    return;
+                }
+
+                if (is_single(targets))
+                {
+                    if (connected(get_token(from_single(targets))))
+                    {
+                        return;
+                    }
+
+                    temp_targets = exchange_targets(nullptr);
+                }
+                else
+                {
+                    auto const array = to_array(targets);
+
+                    auto const is_connected = [&](delegate_type const& element) noexcept
+                    {
+                        return connected(get_token(element));
+                    };
+
+                    auto const remaining = static_cast<uint32_t>(std::count_if(array->begin(), array->end(), is_connected));
+
+                    if (remaining == array->size())
+                    {
+                        return;
+                    }
+
+                    if (remaining == 0)
+                    {
+                        temp_targets = exchange_targets(nullptr);
+                    }
+                    else if (remaining == 1)
+                    {
+                        delegate_type single = *std::find_if(array->begin(), array->end(), is_connected);
+                        temp_targets = exchange_targets(to_single(detach_abi(single)));
+                    }
+                    else
+                    {
+                        delegate_array new_targets = impl::make_event_array<delegate_type>(remaining);
+                        std::copy_if(array->begin(), array->end(), new_targets->begin(), is_connected);
+                        temp_targets = exchange_targets(new_targets.detach());
+                    }
+                }
+            }
+
+            // Releases the old targets outside of lock.
+            release_targets(temp_targets);
+        }
+
+        // The low bit of m_targets marks a single delegate stored inline rather than an event_array.
+        static bool is_single(void* targets) noexcept
+        {
+            return (reinterpret_cast<uintptr_t>(targets) & 1) != 0;
+        }
+
+        static void* to_single(void* delegate) noexcept
+        {
+            return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(delegate) | 1);
+        }
+
+        static void* from_single(void* targets) noexcept
+        {
+            return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(targets) & ~uintptr_t{ 1 });
+        }
+
+        static impl::event_array<delegate_type>* to_array(void* targets) noexcept
+        {
+            return static_cast<impl::event_array<delegate_type>*>(targets);
+        }
+
+        static void release_targets(void* targets) noexcept
+        {
+            if (!targets)
+            {
+                return;
+            }
+
+            if (is_single(targets))
+            {
+                delegate_type single;
+                attach_abi(single, from_single(targets));
+            }
+            else
+            {
+                to_array(targets)->Release();
+            }
+        }
+
+        // Lock-free: writers wait for readers counted in the previous epoch before releasing targets.
+        void* acquire_targets() noexcept
+        {
+            while (true)
+            {
+                uint32_t const epoch = m_epoch.load();
+                auto& readers = m_readers[epoch & 1];
+                ++readers;
+
+                if (m_epoch.load() != epoch)
+                {
+                    --readers;
+                    continue;
+                }
+
+                auto const targets = m_targets.load();
+
+                if (targets && !is_single(targets))
+                {
+                    to_array(targets)->AddRef();
+                }
+                else if (auto const single = from_single(targets))
+                {
+                    static_cast<impl::unknown_abi*>(single)->AddRef();
+                }
+
+                --readers;
+                return targets;
+            }
+        }
+
+        // Must be called while holding m_change. Returns the previous targets and their reference.
+        void* exchange_targets(void* targets) noexcept
+        {
+            auto const previous = m_targets.exchange(targets);
+            uint32_t const epoch = m_epoch++;
+
+            while (m_readers[epoch & 1].load() != 0)
+            {
+                std::this_thread::yield();
+            }
+
+            return previous;
+        }
+
+        std::atomic<void*> m_targets{};
+        std::atomic<uint32_t> m_epoch{};
+        std::atomic<uint32_t> m_readers[2]{};
         slim_mutex m_change;
     };
 }
@@ -11,6 +11,7 @@ extern "C"
     void* __stdcall WINRT_IMPL_LoadLibraryW(wchar_t const* name) noexcept;
     int32_t __stdcall WINRT_IMPL_FreeLibrary(void* library) noexcept;
     void* __stdcall WINRT_IMPL_GetProcAddress(void* library, char const* name) noexcept;
+    int32_t __stdcall WINRT_IMPL_GetModuleHandleExW(uint32_t flags, void const* name, void** module) noexcept;
 
     int32_t __stdcall WINRT_IMPL_SetErrorInfo(uint32_t reserved, void* info) noexcept;
     int32_t __stdcall WINRT_IMPL_GetErrorInfo(uint32_t reserved, void** info) noexcept;
@@ -32,6 +33,7 @@ extern "C"
     int32_t  __stdcall WINRT_IMPL_WideCharToMultiByte(uint32_t codepage, uint32_t flags, wchar_t const* int_string, int32_t in_size, char* out_string, int32_t out_size, char const* default_char, int32_t* default_used) noexcept;
     void* __stdcall    WINRT_IMPL_HeapAlloc(void* heap, uint32_t flags, size_t bytes) noexcept;
     int32_t  __stdcall WINRT_IMPL_HeapFree(void* heap, uint32_t flags, void* value) noexcept;
+    std::size_t __stdcall WINRT_IMPL_HeapSize(void* heap, uint32_t flags, void const* value) noexcept;
     void*    __stdcall WINRT_IMPL_GetProcessHeap() noexcept;
     uint32_t __stdcall WINRT_IMPL_FormatMessageW(uint32_t flags, void const* source, uint32_t code, uint32_t language, wchar_t* buffer, uint32_t size, va_list* arguments) noexcept;
     uint32_t __stdcall WINRT_IMPL_GetLastError() noexcept;
@@ -96,6 +98,7 @@ extern "C"
 WINRT_IMPL_LINK(LoadLibraryW, 4)
 WINRT_IMPL_LINK(FreeLibrary, 4)
 WINRT_IMPL_LINK(GetProcAddress, 8)
+WINRT_IMPL_LINK(GetModuleHandleExW, 12)
 WINRT_IMPL_LINK(SetErrorInfo, 8)
 WINRT_IMPL_LINK(GetErrorInfo, 8)
 WINRT_IMPL_LINK(CoInitializeEx, 8)
@@ -116,6 +119,7 @@ WINRT_IMPL_LINK(MultiByteToWideChar, 24)
 WINRT_IMPL_LINK(WideCharToMultiByte, 32)
 WINRT_IMPL_LINK(HeapAlloc, 12)
 WINRT_IMPL_LINK(HeapFree, 12)
+WINRT_IMPL_LINK(HeapSize, 12)
 WINRT_IMPL_LINK(GetProcessHeap, 0)
 WINRT_IMPL_LINK(FormatMessageW, 28)
 WINRT_IMPL_LINK(GetLastError, 0)
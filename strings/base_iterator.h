@@ -1,6 +1,19 @@
 
 namespace winrt::impl
 {
+    template <typename T, typename Value>
+    class has_GetMany
+    {
+        template <typename U, typename = decltype(std::declval<U>().GetMany(0, std::declval<array_view<Value>>()))> static constexpr bool get_value(int) { return true; }
+        template <typename> static constexpr bool get_value(...) { return false; }
+
+    public:
+
+        static constexpr bool value = get_value<T>(0);
+    };
+
+    // Reads elements in blocks through GetMany as the iterator advances, and through GetAt otherwise or if
+    // GetMany fails. A block is not refreshed, so changes to elements it already holds aren't seen.
     template <typename T>
     struct fast_iterator
     {
@@ -18,6 +31,26 @@ namespace winrt::impl
             m_index(index)
         {}
 
+        fast_iterator(fast_iterator const& other) noexcept :
+            m_collection(other.m_collection),
+            m_index(other.m_index),
+            m_first(other.m_index + 1),
+            m_last(other.m_index + 1)
+        {}
+
+        fast_iterator(fast_iterator&&) noexcept = default;
+        fast_iterator& operator=(fast_iterator&&) noexcept = default;
+
+        fast_iterator& operator=(fast_iterator const& other) noexcept
+        {
+            m_collection = other.m_collection;
+            m_index = other.m_index;
+            m_buffer.clear();
+            m_first = m_index + 1;
+            m_last = m_first;
+            return *this;
+        }
+
         fast_iterator& operator++() noexcept
         {
             ++m_index;
@@ -73,6 +106,17 @@ namespace winrt::impl
 
         reference operator*() const
         {
+            if constexpr (has_GetMany<T, value_type>::value)
+            {
+                if (m_index - m_first < m_last - m_first || (m_index == m_last && read_block()))
+                {
+                    return m_buffer[m_index - m_first];
+                }
+
+                m_first = m_index + 1;
+                m_last = m_first;
+            }
+
             return m_collection->GetAt(m_index);
         }
 
@@ -126,8 +170,44 @@ namespace winrt::impl
 
     private:
 
+        static constexpr uint32_t first_block_size{ 8 };
+        static constexpr uint32_t max_block_size{ 64 };
+
+        bool read_block() const
+        {
+            if (m_no_blocks)
+            {
+                return false;
+            }
+
+            uint32_t const size = m_buffer.empty() ? first_block_size : (std::min)(m_buffer.size() * 2, max_block_size);
+
+            if (size != m_buffer.size())
+            {
+                m_buffer = com_array<value_type>(size, empty_value<value_type>());
+            }
+
+            m_first = m_index;
+
+            try
+            {
+                m_last = m_index + m_collection->GetMany(m_index, m_buffer);
+            }
+            catch (hresult_error const&)
+            {
+                m_no_blocks = true;
+                m_last = m_first;
+            }
+
+            return m_first != m_last;
+        }
+
         T const* m_collection = nullptr;
         uint32_t m_index = 0;
+        mutable com_array<value_type> m_buffer;
+        mutable uint32_t m_first = 0;
+        mutable uint32_t m_last = 0;
+        mutable bool m_no_blocks = false;
     };
 
     template <typename T>
@@ -141,6 +221,157 @@ namespace winrt::impl
         static constexpr bool value = get_value<T>(0);
     };
 
+    template <typename T>
+    class has_batched_First
+    {
+        template <typename U, typename Iterator = decltype(std::declval<U>().First()), typename = decltype(std::declval<Iterator>().GetMany(std::declval<array_view<decltype(std::declval<Iterator>().Current())>>()))> static constexpr bool get_value(int) { return true; }
+        template <typename> static constexpr bool get_value(...) { return false; }
+
+    public:
+
+        static constexpr bool value = get_value<T>(0);
+    };
+
+    // Iterates collections in batches read through IIterator::GetMany, or through MoveNext and
+    // Current if GetMany fails. Copies share their position, as IIterator copies would.
+    template <typename T>
+    struct batched_iterator
+    {
+        using iterator_type = decltype(std::declval<T>().First());
+        using iterator_concept = std::input_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = decltype(std::declval<iterator_type>().Current());
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        batched_iterator() noexcept = default;
+
+        explicit batched_iterator(T const& collection) :
+            m_batch(std::make_shared<batch>(collection.First()))
+        {
+            read_batch();
+        }
+
+        batched_iterator& operator++()
+        {
+            WINRT_ASSERT(m_batch && m_batch->index < m_batch->count);
+
+            if (++m_batch->index == m_batch->count)
+            {
+                read_batch();
+            }
+
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++(*this);
+        }
+
+        reference operator*() const
+        {
+            WINRT_ASSERT(m_batch && m_batch->index < m_batch->count);
+            return m_batch->buffer[m_batch->index];
+        }
+
+        bool operator==(batched_iterator const& other) const noexcept
+        {
+            return m_batch == other.m_batch || (at_end() && other.at_end());
+        }
+
+        bool operator!=(batched_iterator const& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+    private:
+
+        static constexpr uint32_t first_batch_size{ 8 };
+        static constexpr uint32_t max_batch_size{ 64 };
+
+        struct batch
+        {
+            explicit batch(iterator_type&& first) noexcept : iterator(std::move(first))
+            {
+            }
+
+            iterator_type iterator;
+            com_array<value_type> buffer;
+            uint32_t index{};
+            uint32_t count{};
+            bool no_batches{};
+        };
+
+        bool at_end() const noexcept
+        {
+            return !m_batch || m_batch->count == 0;
+        }
+
+        void read_batch()
+        {
+            auto& current = *m_batch;
+            uint32_t const size = current.buffer.empty() ? first_batch_size : (std::min)(current.buffer.size() * 2, max_batch_size);
+
+            if (size != current.buffer.size() && !current.no_batches)
+            {
+                current.buffer = com_array<value_type>(size, empty_value<value_type>());
+            }
+
+            current.index = 0;
+            current.count = read(current);
+
+            if (current.count == 0)
+            {
+                current.iterator = nullptr;
+                current.buffer.clear();
+            }
+        }
+
+        static uint32_t read(batch& current)
+        {
+            if (!current.no_batches)
+            {
+                try
+                {
+                    return current.iterator.GetMany(current.buffer);
+                }
+                catch (hresult_error const&)
+                {
+                    current.no_batches = true;
+                }
+            }
+
+            if (!current.iterator.HasCurrent())
+            {
+                return 0;
+            }
+
+            current.buffer[0] = current.iterator.Current();
+            current.iterator.MoveNext();
+            return 1;
+        }
+
+        std::shared_ptr<batch> m_batch;
+    };
+
+    template <typename T>
+    struct batched_range
+    {
+        batched_iterator<T> begin() const
+        {
+            return batched_iterator<T>{ collection };
+        }
+
+        batched_iterator<T> end() const noexcept
+        {
+            return {};
+        }
+
+        T collection;
+    };
+
     template <typename T, std::enable_if_t<!has_GetAt<T>::value, int> = 0>
     auto get_begin_iterator(T const& collection) -> decltype(collection.First())
     {
@@ -187,3 +418,14 @@ namespace winrt::impl
     using std::begin;
     using std::end;
 }
+
+WINRT_EXPORT namespace winrt
+{
+    // Iterates a collection in batches read through IIterator::GetMany rather than calling MoveNext
+    // and Current for each element. Best suited to loops that visit every element.
+    template <typename T, std::enable_if_t<impl::has_batched_First<T>::value, int> = 0>
+    impl::batched_range<T> batched(T const& collection)
+    {
+        return { collection };
+    }
+}
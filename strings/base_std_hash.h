@@ -1,25 +1,44 @@
-
 namespace winrt::impl
 {
+    // Hashes eight bytes at a time in the manner of xxHash64.
+    inline uint64_t hash_round(uint64_t result, uint64_t value) noexcept
+    {
+        result += value * 0xC2B2AE3D27D4EB4FULL;
+        result = (result << 31) | (result >> 33);
+        return result * 0x9E3779B185EBCA87ULL;
+    }
+
+    inline size_t hash_finish(uint64_t result) noexcept
+    {
+        result ^= result >> 33;
+        result *= 0xC2B2AE3D27D4EB4FULL;
+        result ^= result >> 29;
+        result *= 0x165667B19E3779F9ULL;
+        result ^= result >> 32;
+        return static_cast<size_t>(result);
+    }
+
     inline size_t hash_data(void const* ptr, size_t const bytes) noexcept
     {
-#ifdef _WIN64
-        constexpr size_t fnv_offset_basis = 14695981039346656037ULL;
-        constexpr size_t fnv_prime = 1099511628211ULL;
-#else
-        constexpr size_t fnv_offset_basis = 2166136261U;
-        constexpr size_t fnv_prime = 16777619U;
-#endif
-        size_t result = fnv_offset_basis;
-        uint8_t const* const buffer = static_cast<uint8_t const*>(ptr);
-
-        for (size_t next = 0; next < bytes; ++next)
+        uint8_t const* buffer = static_cast<uint8_t const*>(ptr);
+        uint64_t result = 0x27D4EB2F165667C5ULL + bytes;
+        size_t remaining = bytes;
+
+        for (; remaining >= sizeof(uint64_t); remaining -= sizeof(uint64_t), buffer += sizeof(uint64_t))
+        {
+            uint64_t value;
+            memcpy(&value, buffer, sizeof(value));
+            result = hash_round(result, value);
+        }
+
+        if (remaining)
         {
-            result ^= buffer[next];
-            result *= fnv_prime;
+            uint64_t value{};
+            memcpy(&value, buffer, remaining);
+            result = hash_round(result, value);
         }
 
-        return result;
+        return hash_finish(result);
     }
 
     struct hash_base
@@ -5,7 +5,7 @@ namespace winrt::impl
     {
         atomic_ref_count() noexcept = default;
 
-        explicit atomic_ref_count(uint32_t count) noexcept : m_count(count)
+        constexpr explicit atomic_ref_count(uint32_t count) noexcept : m_count(count)
         {
         }
 
@@ -62,12 +62,154 @@ namespace winrt::impl
         wchar_t buffer[1];
     };
 
+    // A static_hstring starts with a reference count that other components may adjust but never exhaust.
+    // Only the exact count is skipped; while another component holds a reference it is counted normally.
+    constexpr uint32_t hstring_immortal_count{ 0x40000000 };
+
+    inline bool is_immortal_hstring(shared_hstring_header const* header) noexcept
+    {
+        return header->count == hstring_immortal_count;
+    }
+
+    // A bounded list of free blocks for one thread, though its blocks may be pushed onto another thread's
+    // list. Blocks that don't fit are returned with Release.
+    template <void (*Release)(void*) noexcept, uint32_t Capacity>
+    struct free_list
+    {
+        free_list() noexcept = default;
+        free_list(free_list const&) = delete;
+        free_list& operator=(free_list const&) = delete;
+
+        ~free_list() noexcept
+        {
+            m_closed = true;
+
+            while (void* block = pop())
+            {
+                Release(block);
+            }
+        }
+
+        void* pop() noexcept
+        {
+            void* block = m_head;
+
+            if (block)
+            {
+                m_head = *static_cast<void**>(block);
+                --m_count;
+            }
+
+            return block;
+        }
+
+        void push(void* block) noexcept
+        {
+            // Blocks may still be released by other thread_local destructors after this one.
+            if (m_closed || m_count == Capacity)
+            {
+                Release(block);
+                return;
+            }
+
+            *static_cast<void**>(block) = m_head;
+            m_head = block;
+            ++m_count;
+        }
+
+    private:
+
+        void* m_head{};
+        uint32_t m_count{};
+        bool m_closed{};
+    };
+
+    // An opt-in cache of short string allocations, enabled by defining WINRT_HSTRING_POOL. Released
+    // blocks are kept on a per-thread list for reuse rather than going back to the process heap.
+    struct hstring_pool
+    {
+        static constexpr uint32_t class_length{ 16 };
+        static constexpr uint32_t class_count{ 4 };
+        static constexpr uint32_t max_length{ class_length * class_count };
+        static constexpr uint32_t max_cached{ 64 };
+
+        static shared_hstring_header* allocate(uint32_t length) noexcept
+        {
+            WINRT_ASSERT(length != 0 && length <= max_length);
+            uint32_t const index = get_index(length);
+            auto header = static_cast<shared_hstring_header*>(get_cache(index).pop());
+
+            if (!header)
+            {
+                header = static_cast<shared_hstring_header*>(WINRT_IMPL_HeapAlloc(WINRT_IMPL_GetProcessHeap(), 0, get_block_size(index)));
+            }
+
+            return header;
+        }
+
+        // The header may have been created by another component, so the heap rather than the header
+        // decides whether the block is large enough for the size class.
+        static bool free(hstring_header* header) noexcept
+        {
+            if (header->length == 0 || header->length > max_length)
+            {
+                return false;
+            }
+
+            uint32_t const index = get_index(header->length);
+            std::size_t const size = WINRT_IMPL_HeapSize(WINRT_IMPL_GetProcessHeap(), 0, header);
+
+            if (size == static_cast<std::size_t>(-1) || size < get_block_size(index))
+            {
+                return false;
+            }
+
+            get_cache(index).push(header);
+            return true;
+        }
+
+    private:
+
+        static constexpr uint32_t get_index(uint32_t length) noexcept
+        {
+            return (length - 1) / class_length;
+        }
+
+        static constexpr std::size_t get_block_size(uint32_t index) noexcept
+        {
+            return sizeof(shared_hstring_header) + sizeof(wchar_t) * class_length * (index + 1);
+        }
+
+        static void release(void* block) noexcept
+        {
+            WINRT_IMPL_HeapFree(WINRT_IMPL_GetProcessHeap(), 0, block);
+        }
+
+        static free_list<release, max_cached>& get_cache(uint32_t index) noexcept
+        {
+            static thread_local free_list<release, max_cached> lists[class_count];
+            return lists[index];
+        }
+    };
+
     inline void release_hstring(hstring_header* handle) noexcept
     {
         WINRT_ASSERT((handle->flags & hstring_reference_flag) == 0);
 
+        if (is_immortal_hstring(static_cast<shared_hstring_header*>(handle)))
+        {
+            return;
+        }
+
         if (0 == --static_cast<shared_hstring_header*>(handle)->count)
         {
+#ifdef WINRT_HSTRING_POOL
+            if (hstring_pool::free(handle))
+            {
+                return;
+            }
+#endif
+
             WINRT_IMPL_HeapFree(WINRT_IMPL_GetProcessHeap(), 0, handle);
         }
     }
@@ -82,7 +224,18 @@ namespace winrt::impl
             throw std::invalid_argument("length");
         }
 
-        auto header = static_cast<shared_hstring_header*>(WINRT_IMPL_HeapAlloc(WINRT_IMPL_GetProcessHeap(), 0, static_cast<std::size_t>(bytes_required)));
+        shared_hstring_header* header{};
+
+#ifdef WINRT_HSTRING_POOL
+        if (length <= hstring_pool::max_length)
+        {
+            header = hstring_pool::allocate(length);
+        }
+        else
+#endif
+        {
+            header = static_cast<shared_hstring_header*>(WINRT_IMPL_HeapAlloc(WINRT_IMPL_GetProcessHeap(), 0, static_cast<std::size_t>(bytes_required)));
+        }
 
         if (!header)
         {
@@ -132,7 +285,11 @@ namespace winrt::impl
         }
         else if ((handle->flags & hstring_reference_flag) == 0)
         {
-            ++static_cast<shared_hstring_header*>(handle)->count;
+            if (!is_immortal_hstring(static_cast<shared_hstring_header*>(handle)))
+            {
+                ++static_cast<shared_hstring_header*>(handle)->count;
+            }
+
             return handle;
         }
         else
@@ -386,6 +543,57 @@ WINRT_EXPORT namespace winrt
         handle_type<impl::hstring_traits> m_handle;
     };
 
+    // Wraps a string literal in an immortal string header. Other components may write the header, so
+    // declare it inline rather than constexpr; it is still initialized at compile time.
+    struct static_hstring
+    {
+        template <uint32_t Size>
+        constexpr static_hstring(wchar_t const (&value)[Size]) noexcept :
+            m_header{ { 0, Size - 1, 0, 0, value }, impl::atomic_ref_count{ impl::hstring_immortal_count }, {} }
+        {
+            if (value[Size - 1] != 0)
+            {
+                abort();
+            }
+        }
+
+        // Not a literal type, so it can't be declared constexpr and placed in read-only memory.
+        ~static_hstring() noexcept
+        {
+        }
+
+        static_hstring(static_hstring const&) = delete;
+        static_hstring& operator=(static_hstring const&) = delete;
+
+        operator hstring() const noexcept
+        {
+            if (m_header.length == 0)
+            {
+                return {};
+            }
+
+            // The handle may outlive this module once it crosses the ABI, so pin the module holding it.
+            if (!m_pinned.load(std::memory_order_relaxed))
+            {
+                void* module{};
+                WINRT_IMPL_GetModuleHandleExW(0x1 | 0x4, &m_header, &module); // GET_MODULE_HANDLE_EX_FLAG_PIN | GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS
+                m_pinned.store(true, std::memory_order_relaxed);
+            }
+
+            return { static_cast<impl::hstring_header*>(&m_header), take_ownership_from_abi };
+        }
+
+        operator std::wstring_view() const noexcept
+        {
+            return { m_header.ptr, m_header.length };
+        }
+
+    private:
+
+        mutable impl::shared_hstring_header m_header;
+        mutable std::atomic<bool> m_pinned{};
+    };
+
     inline void* get_abi(hstring const& object) noexcept
     {
         return *(void**)(&object);
@@ -464,6 +672,15 @@ namespace winrt::impl
             return const_cast<wchar_t*>(m_handle.get()->ptr);
         }
 
+        // Shortens the string in place, for callers that size the builder for the worst case.
+        void truncate(uint32_t const size) noexcept
+        {
+            auto header = m_handle.get();
+            WINRT_ASSERT(size != 0 && size <= header->length);
+            header->length = size;
+            data()[size] = 0;
+        }
+
         hstring to_hstring()
         {
             return { m_handle.detach(), take_ownership_from_abi };
@@ -526,7 +743,7 @@ namespace winrt::impl
     };
 
     template <typename T>
-    inline hstring hstring_convert(T value)
+    inline std::wstring_view format_number(T value, wchar_t (&buffer)[32]) noexcept
     {
         static_assert(std::is_arithmetic_v<T>);
         char temp[32];
@@ -541,9 +758,82 @@ namespace winrt::impl
             result = std::to_chars(std::begin(temp), std::end(temp), value, std::chars_format::general);
         }
         WINRT_ASSERT(result.ec == std::errc{});
-        wchar_t buffer[32];
         auto end = std::copy(std::begin(temp), result.ptr, buffer);
-        return hstring{ std::wstring_view{ buffer, static_cast<std::size_t>(end - buffer)} };
+        return { buffer, static_cast<std::size_t>(end - buffer) };
+    }
+
+    template <typename T>
+    inline hstring hstring_convert(T value)
+    {
+        wchar_t buffer[32];
+        return hstring{ format_number(value, buffer) };
+    }
+
+    inline std::wstring_view format_guid(guid const& value, wchar_t (&buffer)[40]) noexcept
+    {
+        //{00000000-0000-0000-0000-000000000000}
+        swprintf_s(buffer, L"{%08x-%04hx-%04hx-%02hhx%02hhx-%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx}",
+            value.Data1, value.Data2, value.Data3, value.Data4[0], value.Data4[1],
+            value.Data4[2], value.Data4[3], value.Data4[4], value.Data4[5], value.Data4[6], value.Data4[7]);
+        return { buffer, 38 };
+    }
+
+    // Copies the leading ASCII characters, returning how many were copied; the rest is left to the system.
+    inline uint32_t widen_ascii(char const* value, uint32_t const size, wchar_t* buffer) noexcept
+    {
+        uint32_t index = 0;
+
+        for (; index + 8 <= size; index += 8)
+        {
+            uint64_t word;
+            memcpy(&word, value + index, sizeof(word));
+
+            if (word & 0x8080808080808080)
+            {
+                break;
+            }
+
+            for (uint32_t offset = 0; offset < 8; ++offset)
+            {
+                buffer[index + offset] = static_cast<wchar_t>(value[index + offset]);
+            }
+        }
+
+        for (; index < size && static_cast<uint8_t>(value[index]) < 0x80; ++index)
+        {
+            buffer[index] = static_cast<wchar_t>(value[index]);
+        }
+
+        return index;
+    }
+
+    inline uint32_t narrow_ascii(wchar_t const* value, uint32_t const size, char* buffer) noexcept
+    {
+        static_assert(sizeof(wchar_t) == 2);
+        uint32_t index = 0;
+
+        for (; index + 4 <= size; index += 4)
+        {
+            uint64_t word;
+            memcpy(&word, value + index, sizeof(word));
+
+            if (word & 0xFF80FF80FF80FF80)
+            {
+                break;
+            }
+
+            for (uint32_t offset = 0; offset < 4; ++offset)
+            {
+                buffer[index + offset] = static_cast<char>(value[index + offset]);
+            }
+        }
+
+        for (; index < size && value[index] < 0x80; ++index)
+        {
+            buffer[index] = static_cast<char>(value[index]);
+        }
+
+        return index;
     }
 }
 
@@ -634,40 +924,267 @@ WINRT_EXPORT namespace winrt
     inline hstring to_hstring(guid const& value)
     {
         wchar_t buffer[40];
-        //{00000000-0000-0000-0000-000000000000}
-        swprintf_s(buffer, L"{%08x-%04hx-%04hx-%02hhx%02hhx-%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx}",
-            value.Data1, value.Data2, value.Data3, value.Data4[0], value.Data4[1],
-            value.Data4[2], value.Data4[3], value.Data4[4], value.Data4[5], value.Data4[6], value.Data4[7]);
-        return hstring{ buffer };
+        return hstring{ impl::format_guid(value, buffer) };
     }
 
     template <typename T, std::enable_if_t<std::is_convertible_v<T, std::string_view>, int> = 0>
     hstring to_hstring(T const& value)
     {
         std::string_view const view(value);
-        int const size = WINRT_IMPL_MultiByteToWideChar(65001 /*CP_UTF8*/, 0, view.data(), static_cast<int32_t>(view.size()), nullptr, 0);
+        auto const size = static_cast<uint32_t>(view.size());
 
         if (size == 0)
         {
             return{};
         }
 
+        // UTF-8 never needs fewer bytes than UTF-16 needs code units.
         impl::hstring_builder result(size);
-        WINRT_VERIFY_(size, WINRT_IMPL_MultiByteToWideChar(65001 /*CP_UTF8*/, 0, view.data(), static_cast<int32_t>(view.size()), result.data(), size));
+        uint32_t const ascii = impl::widen_ascii(view.data(), size, result.data());
+
+        if (ascii == size)
+        {
+            return result.to_hstring();
+        }
+
+        int32_t const converted = WINRT_IMPL_MultiByteToWideChar(65001 /*CP_UTF8*/, 0, view.data() + ascii, static_cast<int32_t>(size - ascii), result.data() + ascii, static_cast<int32_t>(size - ascii));
+        uint32_t const length = ascii + static_cast<uint32_t>(converted);
+
+        if (length == 0)
+        {
+            return{};
+        }
+
+        // Mostly ideographic text may leave much of the buffer unused, so it's worth a copy to return the excess.
+        if (length < size / 2)
+        {
+            return hstring{ result.data(), length };
+        }
+
+        result.truncate(length);
         return result.to_hstring();
     }
 
     inline std::string to_string(std::wstring_view value)
     {
-        int const size = WINRT_IMPL_WideCharToMultiByte(65001 /*CP_UTF8*/, 0, value.data(), static_cast<int32_t>(value.size()), nullptr, 0, nullptr, nullptr);
+        auto const size = static_cast<uint32_t>(value.size());
+        std::string result(size, '?');
+        uint32_t const ascii = impl::narrow_ascii(value.data(), size, result.data());
 
-        if (size == 0)
+        if (ascii == size)
         {
-            return{};
+            return result;
         }
 
-        std::string result(size, '?');
-        WINRT_VERIFY_(size, WINRT_IMPL_WideCharToMultiByte(65001 /*CP_UTF8*/, 0, value.data(), static_cast<int32_t>(value.size()), result.data(), size, nullptr, nullptr));
+        // A UTF-16 code unit never needs more than three bytes of UTF-8.
+        auto const remaining = static_cast<int32_t>(size - ascii);
+        int32_t const capacity = remaining <= INT32_MAX / 3 ? remaining * 3 : WINRT_IMPL_WideCharToMultiByte(65001 /*CP_UTF8*/, 0, value.data() + ascii, remaining, nullptr, 0, nullptr, nullptr);
+        result.resize(ascii + static_cast<std::size_t>(capacity));
+        int32_t const converted = WINRT_IMPL_WideCharToMultiByte(65001 /*CP_UTF8*/, 0, value.data() + ascii, remaining, result.data() + ascii, capacity, nullptr, nullptr);
+        result.resize(ascii + static_cast<std::size_t>(converted));
         return result;
     }
+
+    // Builds a string of unknown length in the storage of an hstring and then hands that storage over.
+    struct hstring_writer
+    {
+        using value_type = wchar_t;
+        using size_type = uint32_t;
+
+        hstring_writer() noexcept = default;
+        hstring_writer(hstring_writer const&) = delete;
+        hstring_writer& operator=(hstring_writer const&) = delete;
+
+        explicit hstring_writer(size_type const capacity)
+        {
+            reserve(capacity);
+        }
+
+        hstring_writer(hstring_writer&& other) noexcept :
+            m_handle(std::move(other.m_handle)),
+            m_size(std::exchange(other.m_size, 0))
+        {
+        }
+
+        hstring_writer& operator=(hstring_writer&& other) noexcept
+        {
+            m_handle = std::move(other.m_handle);
+            m_size = std::exchange(other.m_size, 0);
+            return *this;
+        }
+
+        size_type size() const noexcept
+        {
+            return m_size;
+        }
+
+        size_type capacity() const noexcept
+        {
+            return m_handle ? m_handle.get()->length : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        wchar_t* data() noexcept
+        {
+            return m_handle ? const_cast<wchar_t*>(m_handle.get()->ptr) : nullptr;
+        }
+
+        operator std::wstring_view() const noexcept
+        {
+            if (m_size == 0)
+            {
+                return {};
+            }
+
+            return { m_handle.get()->ptr, m_size };
+        }
+
+        void clear() noexcept
+        {
+            m_size = 0;
+        }
+
+        void reserve(size_type const capacity)
+        {
+            if (capacity <= this->capacity())
+            {
+                return;
+            }
+
+            handle_type<impl::hstring_traits> handle{ impl::precreate_hstring_on_heap(capacity) };
+
+            if (m_size)
+            {
+                memcpy_s(const_cast<wchar_t*>(handle.get()->ptr), capacity * sizeof(wchar_t), data(), m_size * sizeof(wchar_t));
+            }
+
+            m_handle = std::move(handle);
+        }
+
+        // Leaves any new characters uninitialized so that they may be written through data().
+        void resize(size_type const size)
+        {
+            if (size > capacity())
+            {
+                reserve(size);
+            }
+
+            m_size = size;
+        }
+
+        void shrink_to_fit()
+        {
+            if (m_size == 0)
+            {
+                m_handle.close();
+            }
+            else if (m_size < capacity())
+            {
+                hstring_writer other(m_size);
+                other.append(*this);
+                *this = std::move(other);
+            }
+        }
+
+        hstring_writer& append(std::wstring_view const& value)
+        {
+            if (!value.empty())
+            {
+                wchar_t* position = grow(value.size());
+                memcpy_s(position, value.size() * sizeof(wchar_t), value.data(), value.size() * sizeof(wchar_t));
+            }
+
+            return *this;
+        }
+
+        hstring_writer& append(wchar_t const value)
+        {
+            *grow(1) = value;
+            return *this;
+        }
+
+        hstring_writer& append(char16_t const value)
+        {
+            return append(static_cast<wchar_t>(value));
+        }
+
+        // Would otherwise be ambiguous between wchar_t and char16_t.
+        hstring_writer& append(char const value) = delete;
+
+        template <typename T, std::enable_if_t<std::is_same_v<T, bool>, int> = 0>
+        hstring_writer& append(T const value)
+        {
+            return append(value ? std::wstring_view{ L"true" } : std::wstring_view{ L"false" });
+        }
+
+        template <typename T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t>, int> = 0>
+        hstring_writer& append(T const value)
+        {
+            wchar_t buffer[32];
+            return append(impl::format_number(value, buffer));
+        }
+
+        hstring_writer& append(guid const& value)
+        {
+            wchar_t buffer[40];
+            return append(impl::format_guid(value, buffer));
+        }
+
+        void push_back(wchar_t const value)
+        {
+            append(value);
+        }
+
+        template <typename T>
+        hstring_writer& operator+=(T const& value)
+        {
+            return append(value);
+        }
+
+        // Hands the storage, including any excess capacity, to the resulting hstring.
+        hstring to_hstring()
+        {
+            if (m_size == 0)
+            {
+                m_handle.close();
+                return {};
+            }
+
+            auto header = m_handle.get();
+            header->length = std::exchange(m_size, 0);
+            const_cast<wchar_t*>(header->ptr)[header->length] = 0;
+            return { m_handle.detach(), take_ownership_from_abi };
+        }
+
+    private:
+
+        // Makes room for count more characters and returns where they should be written.
+        wchar_t* grow(std::size_t const count)
+        {
+            std::size_t const required = m_size + count;
+
+            if (required > UINT_MAX)
+            {
+                throw std::invalid_argument("length");
+            }
+
+            if (required > capacity())
+            {
+                std::size_t const doubled = static_cast<std::size_t>(capacity()) * 2;
+                reserve(static_cast<size_type>(std::max<std::size_t>({ required, std::min<std::size_t>(doubled, UINT_MAX / sizeof(wchar_t) / 2), 16 })));
+            }
+
+            wchar_t* position = data() + m_size;
+            m_size = static_cast<size_type>(required);
+            return position;
+        }
+
+        handle_type<impl::hstring_traits> m_handle;
+        size_type m_size{};
+    };
 }
+
@@ -96,18 +96,47 @@ WINRT_EXPORT namespace winrt
 
 namespace winrt::impl
 {
-    inline hstring concat_hstring(std::wstring_view const& left, std::wstring_view const& right)
+    inline hstring concat_hstring(std::initializer_list<std::wstring_view> values)
     {
-        auto size = static_cast<uint32_t>(left.size() + right.size());
+        std::size_t size = 0;
+
+        for (auto&& value : values)
+        {
+            size += value.size();
+        }
+
         if (size == 0)
         {
             return{};
         }
-        hstring_builder text(size);
-        memcpy_s(text.data(), left.size() * sizeof(wchar_t), left.data(), left.size() * sizeof(wchar_t));
-        memcpy_s(text.data() + left.size(), right.size() * sizeof(wchar_t), right.data(), right.size() * sizeof(wchar_t));
+
+        hstring_builder text(static_cast<uint32_t>(size));
+        wchar_t* position = text.data();
+
+        for (auto&& value : values)
+        {
+            memcpy_s(position, value.size() * sizeof(wchar_t), value.data(), value.size() * sizeof(wchar_t));
+            position += value.size();
+        }
+
         return text.to_hstring();
     }
+
+    inline hstring concat_hstring(std::wstring_view const& left, std::wstring_view const& right)
+    {
+        return concat_hstring({ left, right });
+    }
+
+    inline std::wstring_view concat_piece(wchar_t const& value) noexcept
+    {
+        return { &value, 1 };
+    }
+
+    template <typename T>
+    std::wstring_view concat_piece(T const& value) noexcept
+    {
+        return value;
+    }
 }
 
 WINRT_EXPORT namespace winrt
@@ -160,4 +189,11 @@ WINRT_EXPORT namespace winrt
     {
         return impl::concat_hstring(left, right);
     }
+
+    // Concatenates any mix of strings and characters with a single allocation.
+    template <typename... Args>
+    hstring concat(Args const&... args)
+    {
+        return impl::concat_hstring({ impl::concat_piece(args)... });
+    }
 }
@@ -1,12 +1,22 @@
 
 namespace winrt::impl
 {
+    // Part of every factory cache entry so that its layout doesn't depend on WINRT_DIAGNOSTICS,
+    // but only updated when it is defined.
+    struct factory_cache_counters
+    {
+        std::atomic<uint32_t> hits;
+        std::atomic<uint32_t> contention;
+    };
+
 #ifdef WINRT_DIAGNOSTICS
 
     struct factory_diagnostics_info
     {
         bool is_agile{ true };
         uint32_t requests{ 0 };
+        uint32_t hits{ 0 };
+        uint32_t contention{ 0 };
     };
 
     struct diagnostics_info
@@ -25,11 +35,12 @@ namespace winrt::impl
         }
 
         template <typename T>
-        void add_factory()
+        void add_factory(factory_cache_counters& counters)
         {
             slim_lock_guard const guard(m_lock);
             factory_diagnostics_info& factory = m_info.factories[name_of<T>()];
             ++factory.requests;
+            m_counters.emplace(&counters, name_of<T>());
         }
 
         template <typename T>
@@ -43,19 +54,45 @@ namespace winrt::impl
         auto get()
         {
             slim_lock_guard const guard(m_lock);
-            return m_info;
+            diagnostics_info info = m_info;
+
+            for (auto&& [counters, name] : m_counters)
+            {
+                add_counters(info, name, counters->hits.load(std::memory_order_relaxed), counters->contention.load(std::memory_order_relaxed));
+            }
+
+            return info;
         }
 
         auto detach()
         {
             slim_lock_guard const guard(m_lock);
-            return std::move(m_info);
+            diagnostics_info info = std::move(m_info);
+            m_info = {};
+
+            for (auto&& [counters, name] : m_counters)
+            {
+                add_counters(info, name, counters->hits.exchange(0, std::memory_order_relaxed), counters->contention.exchange(0, std::memory_order_relaxed));
+            }
+
+            return info;
         }
 
     private:
 
+        static void add_counters(diagnostics_info& info, std::wstring_view const& name, uint32_t hits, uint32_t contention)
+        {
+            if (hits || contention)
+            {
+                factory_diagnostics_info& factory = info.factories[name];
+                factory.hits += hits;
+                factory.contention += contention;
+            }
+        }
+
         slim_mutex m_lock;
         diagnostics_info m_info;
+        std::map<factory_cache_counters*, std::wstring_view> m_counters;
     };
 
     inline diagnostics_cache& get_diagnostics_info() noexcept
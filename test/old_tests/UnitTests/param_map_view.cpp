@@ -31,7 +31,7 @@ namespace
         return make_copy(param);
     }
 
-    void test_map_view(param::map_view<int, int> const& param)
+    void test_map_view(param::map_view<int, int> const& param, bool const splittable = false)
     {
         IMapView<int, int> values = make_copy(param);
 
@@ -54,8 +54,22 @@ namespace
 
         IMapView<int, int> left, right;
         values.Split(left, right);
-        REQUIRE(left == nullptr);
-        REQUIRE(right == nullptr);
+
+        // Ordered maps with a version are split in half, while input maps and unordered maps cannot be split.
+        if (splittable)
+        {
+            REQUIRE(left.Size() == 1);
+            REQUIRE(right.Size() == 2);
+            REQUIRE(left.HasKey(1));
+            REQUIRE(!left.HasKey(2));
+            REQUIRE(20 == right.Lookup(2));
+            REQUIRE(30 == right.Lookup(3));
+        }
+        else
+        {
+            REQUIRE(left == nullptr);
+            REQUIRE(right == nullptr);
+        }
     }
 
     struct viewable
@@ -89,10 +103,10 @@ TEST_CASE("test_map_view")
 
     // WinRT interface
     IMapView<int, int> view = single_threaded_map<int, int>(std::map<int, int>{ { 1, 10 }, { 2,20 }, { 3,30 } }).GetView();
-    test_map_view(view);
+    test_map_view(view, true);
 
     // Convertible WinRT interface
-    test_map_view(viewable());
+    test_map_view(viewable(), true);
 }
 
 TEST_CASE("test_map_view_scope")
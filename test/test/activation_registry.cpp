@@ -0,0 +1,64 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    struct registered_factory : implements<registered_factory, IActivationFactory>
+    {
+        inline static uint32_t created{};
+
+        registered_factory()
+        {
+            ++created;
+        }
+
+        IInspectable ActivateInstance() const
+        {
+            return make<registered_factory>();
+        }
+    };
+
+    void* make_registered_factory()
+    {
+        return detach_abi(make<registered_factory>());
+    }
+
+    void* throw_from_factory()
+    {
+        throw hresult_invalid_argument();
+    }
+}
+
+TEST_CASE("activation_registry")
+{
+    hstring const name = L"Test.ActivationRegistry.Registered";
+    REQUIRE(!try_get_activation_factory(name));
+
+    register_activation_factory(name, make_registered_factory);
+    registered_factory::created = 0;
+
+    auto factory = get_activation_factory(name);
+    REQUIRE(registered_factory::created == 1);
+    REQUIRE(factory.ActivateInstance<IInspectable>());
+    REQUIRE(registered_factory::created == 2);
+
+    // Other interfaces are queried from the registered factory.
+    REQUIRE(get_activation_factory<IActivationFactory>(name));
+    REQUIRE_THROWS_AS(get_activation_factory<IStringable>(name), hresult_no_interface);
+
+    // Registering a null function defers to the usual activation path again.
+    register_activation_factory(name, nullptr);
+    REQUIRE(!try_get_activation_factory(name));
+}
+
+TEST_CASE("activation_registry,throws")
+{
+    // Exceptions thrown by a registered factory function are returned as errors.
+    hstring const name = L"Test.ActivationRegistry.Throws";
+    register_activation_factory(name, throw_from_factory);
+    REQUIRE_THROWS_AS(get_activation_factory(name), hresult_invalid_argument);
+    REQUIRE(!try_get_activation_factory(name));
+    register_activation_factory(name, nullptr);
+}
@@ -0,0 +1,103 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation::Collections;
+
+namespace
+{
+    struct without_GetMany : implements<without_GetMany, IIterator<int>>
+    {
+        int Current() const
+        {
+            return m_current;
+        }
+
+        bool HasCurrent() const noexcept
+        {
+            return m_current < 20;
+        }
+
+        bool MoveNext() noexcept
+        {
+            return ++m_current < 20;
+        }
+
+        uint32_t GetMany(array_view<int>) const
+        {
+            throw hresult_not_implemented();
+        }
+
+        int m_current{};
+    };
+
+    struct iterable_without_GetMany : implements<iterable_without_GetMany, IIterable<int>>
+    {
+        IIterator<int> First() const
+        {
+            return make<without_GetMany>();
+        }
+    };
+}
+
+// batched iterates collections in batches read through IIterator::GetMany.
+TEST_CASE("batched_iterator")
+{
+    // Sizes on either side of each batch boundary.
+    for (uint32_t size : { 0u, 1u, 7u, 8u, 9u, 23u, 24u, 25u, 100u, 1000u })
+    {
+        std::vector<hstring> expected;
+        std::map<hstring, uint32_t> expected_map;
+
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            expected.push_back(to_hstring(i));
+            expected_map.emplace(to_hstring(i), i);
+        }
+
+        IIterable<hstring> iterable = single_threaded_vector<hstring>(std::vector<hstring>(expected));
+        auto range = batched(iterable);
+        std::vector<hstring> result(range.begin(), range.end());
+        REQUIRE(result == expected);
+
+        IMapView<hstring, uint32_t> view = single_threaded_map<hstring, uint32_t>(std::map<hstring, uint32_t>(expected_map)).GetView();
+        std::map<hstring, uint32_t> result_map;
+
+        for (auto&& pair : batched(view))
+        {
+            result_map.emplace(pair.Key(), pair.Value());
+        }
+
+        REQUIRE(result_map == expected_map);
+    }
+
+    // Copies share their position with the iterator they were copied from.
+    auto range = batched(single_threaded_vector<int>({ 1, 2, 3 }));
+    auto first = range.begin();
+    auto copy = first;
+    REQUIRE(copy == first);
+    ++copy;
+    REQUIRE(*first == 2);
+    ++first;
+    ++first;
+    REQUIRE(first == range.end());
+    REQUIRE(copy == range.end());
+
+    // Without batched, begin still returns the collection's iterator.
+    IIterable<int> iterable = single_threaded_vector<int>({ 1, 2, 3 });
+    static_assert(std::is_same_v<decltype(begin(iterable)), IIterator<int>>);
+    REQUIRE(begin(iterable).Current() == 1);
+}
+
+TEST_CASE("batched_iterator,fallback")
+{
+    // Iterators whose GetMany fails are read through MoveNext and Current.
+    IIterable<int> iterable = make<iterable_without_GetMany>();
+    int expected{};
+
+    for (auto&& value : batched(iterable))
+    {
+        REQUIRE(value == expected++);
+    }
+
+    REQUIRE(expected == 20);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+// Timing helpers for the test cases tagged "[.benchmark]", which only run when asked for
+// explicitly with "[benchmark]" and report their results with WARN.
+
+namespace benchmark
+{
+    // Returns the time taken by the callback in microseconds.
+    template <typename Callback>
+    int64_t measure(Callback&& callback)
+    {
+        auto start = std::chrono::steady_clock::now();
+        callback();
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Runs the callback on the given number of threads, passing each one its index, and returns
+    // the time taken by all of them in microseconds.
+    template <typename Callback>
+    int64_t run_threads(uint32_t count, Callback&& callback)
+    {
+        return measure([&]
+            {
+                std::vector<std::thread> threads;
+
+                for (uint32_t thread = 0; thread < count; ++thread)
+                {
+                    threads.emplace_back(callback, thread);
+                }
+
+                for (auto&& thread : threads)
+                {
+                    thread.join();
+                }
+            });
+    }
+}
@@ -199,6 +199,38 @@ struct holds_hresult : public Catch::MatcherBase<hresult_error>
     }
 };
 
+TEST_CASE("disconnected,many")
+{
+    event<EventHandler<int>> source;
+    int connected{};
+
+    // Disconnected handlers are interleaved with connected handlers and all pruned by one raise.
+    for (int i = 0; i < 90; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            source.add([&](auto&&...)
+                {
+                    ++connected;
+                });
+        }
+        else
+        {
+            source.add([](auto&&...)
+                {
+                    throw hresult_error(RPC_E_DISCONNECTED);
+                });
+        }
+    }
+
+    source(nullptr, 123);
+    REQUIRE(connected == 30);
+
+    // Only the connected handlers remain.
+    source(nullptr, 123);
+    REQUIRE(connected == 60);
+}
+
 TEST_CASE("disconnected,action")
 {
     auto private_context = create_instance<IContextCallback>(CLSID_ContextSwitcher);
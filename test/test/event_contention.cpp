@@ -0,0 +1,116 @@
+#include "pch.h"
+#include "benchmark.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    constexpr uint32_t raise_threads = 4;
+    constexpr uint32_t raise_count = 20000;
+
+    // Replicates the raise path that winrt::event used before it became lock-free, where every
+    // raise took a lock just to copy the reference to the targets array.
+    struct locked_event
+    {
+        explicit locked_event(EventHandler<int> const& handler) : m_handler(handler)
+        {
+        }
+
+        void operator()(IInspectable const& sender, int args)
+        {
+            EventHandler<int> handler;
+
+            {
+                slim_lock_guard const guard(m_swap);
+                handler = m_handler;
+            }
+
+            handler(sender, args);
+        }
+
+    private:
+
+        EventHandler<int> m_handler;
+        slim_mutex m_swap;
+    };
+
+    template <typename Raise>
+    int64_t raise_concurrently(Raise&& raise)
+    {
+        return benchmark::run_threads(raise_threads, [&](uint32_t)
+            {
+                for (uint32_t i = 0; i < raise_count; ++i)
+                {
+                    raise();
+                }
+            });
+    }
+}
+
+TEST_CASE("event_contention")
+{
+    event<EventHandler<int>> source;
+    std::atomic<uint32_t> permanent{};
+
+    source.add([&](auto&&...)
+        {
+            ++permanent;
+        });
+
+    // Handlers are added and removed while other threads raise the event. The permanent handler
+    // must observe every raise and removed handlers must not be leaked or released while in use.
+    std::atomic<bool> done{};
+
+    std::thread changer([&]
+        {
+            while (!done)
+            {
+                auto token = source.add([](auto&&...) {});
+                source.remove(token);
+            }
+        });
+
+    raise_concurrently([&]
+        {
+            source(nullptr, 0);
+        });
+
+    done = true;
+    changer.join();
+
+    REQUIRE(permanent == raise_threads * raise_count);
+
+    permanent = 0;
+    source(nullptr, 0);
+    REQUIRE(permanent == 1);
+}
+
+// Compares raise throughput under contention.
+TEST_CASE("event_contention,benchmark", "[.benchmark]")
+{
+    std::atomic<uint32_t> count{};
+
+    EventHandler<int> handler = [&](auto&&...)
+    {
+        ++count;
+    };
+
+    event<EventHandler<int>> lock_free;
+    lock_free.add(handler);
+    locked_event locked(handler);
+
+    auto const lock_free_time = raise_concurrently([&]
+        {
+            lock_free(nullptr, 0);
+        });
+
+    auto const locked_time = raise_concurrently([&]
+        {
+            locked(nullptr, 0);
+        });
+
+    REQUIRE(count == 2 * raise_threads * raise_count);
+
+    WARN("lock-free raise: " << lock_free_time << "us, locked raise: " << locked_time << "us");
+}
@@ -0,0 +1,77 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+// A single handler is stored inline and moves in and out of an array as other handlers come
+// and go, so tokens must continue to identify the same handler regardless of where it lives.
+TEST_CASE("event_single")
+{
+    event<EventHandler<int>> source;
+    int first{};
+    int second{};
+    REQUIRE(!source);
+
+    auto first_token = source.add([&](auto&&...)
+        {
+            ++first;
+        });
+
+    REQUIRE(source);
+    source(nullptr, 0);
+    REQUIRE(first == 1);
+
+    auto second_token = source.add([&](auto&&...)
+        {
+            ++second;
+        });
+
+    source(nullptr, 0);
+    REQUIRE(first == 2);
+    REQUIRE(second == 1);
+
+    source.remove(first_token);
+    source(nullptr, 0);
+    REQUIRE(first == 2);
+    REQUIRE(second == 2);
+
+    // Removing a handler that is no longer registered has no effect.
+    source.remove(first_token);
+    source(nullptr, 0);
+    REQUIRE(second == 3);
+
+    source.remove(second_token);
+    REQUIRE(!source);
+    source(nullptr, 0);
+    REQUIRE(second == 3);
+}
+
+TEST_CASE("event_single,disconnected")
+{
+    event<EventHandler<int>> source;
+
+    source.add([](auto&&...)
+        {
+            throw hresult_error(RPC_E_DISCONNECTED);
+        });
+
+    source(nullptr, 0);
+    REQUIRE(!source);
+}
+
+TEST_CASE("event_single,lifetime")
+{
+    auto object = std::make_shared<int>();
+
+    {
+        event<EventHandler<int>> source;
+
+        source.add([object](auto&&...)
+            {
+            });
+
+        REQUIRE(object.use_count() == 2);
+    }
+
+    REQUIRE(object.use_count() == 1);
+}
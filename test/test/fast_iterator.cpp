@@ -1,4 +1,5 @@
 #include "pch.h"
+#include "benchmark.h"
 
 TEST_CASE("fast_iterator")
 {
@@ -60,3 +61,144 @@ TEST_CASE("fast_iterator")
         REQUIRE(std::is_heap(begin(v), end(v)));
     }
 }
+
+TEST_CASE("fast_iterator,blocks")
+{
+    // Sizes on either side of each block boundary.
+    for (uint32_t size : { 0u, 1u, 7u, 8u, 9u, 23u, 24u, 25u, 100u, 1000u })
+    {
+        std::vector<winrt::hstring> expected;
+
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            expected.push_back(winrt::to_hstring(i));
+        }
+
+        auto v = winrt::single_threaded_vector<winrt::hstring>(std::vector<winrt::hstring>(expected));
+        std::vector<winrt::hstring> result;
+
+        for (auto&& value : v)
+        {
+            result.push_back(value);
+        }
+
+        REQUIRE(result == expected);
+
+        std::vector<winrt::hstring> reversed(rbegin(v), rend(v));
+        REQUIRE(std::equal(reversed.begin(), reversed.end(), expected.rbegin(), expected.rend()));
+    }
+
+    // Dereferencing repeatedly, stepping backwards and copying mid-block all see the same values.
+    auto v = winrt::single_threaded_vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 });
+    auto first = begin(v);
+    REQUIRE(*first == 0);
+    REQUIRE(*first == 0);
+    first += 5;
+    REQUIRE(*first == 5);
+    auto copy = first;
+    REQUIRE(*copy == 5);
+    REQUIRE(*--first == 4);
+    REQUIRE(*++first == 5);
+    REQUIRE(first[6] == 11);
+    copy = begin(v) + 10;
+    REQUIRE(*copy == 10);
+    REQUIRE(*++copy == 11);
+    REQUIRE(++copy == end(v));
+}
+
+namespace
+{
+    struct without_GetMany : winrt::implements<without_GetMany, winrt::Windows::Foundation::Collections::IVectorView<int>, winrt::Windows::Foundation::Collections::IIterable<int>>
+    {
+        int GetAt(uint32_t index) const
+        {
+            return static_cast<int>(index);
+        }
+
+        uint32_t Size() const noexcept
+        {
+            return 20;
+        }
+
+        bool IndexOf(int, uint32_t&) const noexcept
+        {
+            return false;
+        }
+
+        uint32_t GetMany(uint32_t, winrt::array_view<int>) const
+        {
+            throw winrt::hresult_not_implemented();
+        }
+
+        winrt::Windows::Foundation::Collections::IIterator<int> First() const
+        {
+            throw winrt::hresult_not_implemented();
+        }
+    };
+}
+
+TEST_CASE("fast_iterator,fallback")
+{
+    // Collections whose GetMany fails are read through GetAt.
+    winrt::Windows::Foundation::Collections::IVectorView<int> view = winrt::make<without_GetMany>();
+    int expected{};
+
+    for (auto&& value : view)
+    {
+        REQUIRE(value == expected++);
+    }
+
+    REQUIRE(expected == 20);
+}
+
+namespace
+{
+    template <typename T>
+    std::pair<int64_t, int64_t> measure_iteration(winrt::Windows::Foundation::Collections::IVectorView<T> const& view)
+    {
+        uint32_t const size = view.Size();
+
+        auto const per_element = benchmark::measure([&]
+            {
+                for (uint32_t i = 0; i < size; ++i)
+                {
+                    [[maybe_unused]] T value = view.GetAt(i);
+                }
+            });
+
+        auto const blocks = benchmark::measure([&]
+            {
+                for (auto&& value : view)
+                {
+                    [[maybe_unused]] T copy = value;
+                }
+            });
+
+        return { per_element, blocks };
+    }
+}
+
+// Compares iteration through GetAt with iteration in blocks.
+TEST_CASE("fast_iterator,benchmark", "[.benchmark]")
+{
+    constexpr uint32_t size = 100000;
+
+    std::vector<int32_t> integers;
+    std::vector<winrt::hstring> strings;
+    std::vector<winrt::Windows::Foundation::IInspectable> objects;
+
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        integers.push_back(static_cast<int32_t>(i));
+        strings.push_back(winrt::to_hstring(i));
+        objects.push_back(winrt::box_value(i));
+    }
+
+    auto const [integers_per_element, integers_blocks] = measure_iteration(winrt::single_threaded_vector(std::move(integers)).GetView());
+    auto const [strings_per_element, strings_blocks] = measure_iteration(winrt::single_threaded_vector(std::move(strings)).GetView());
+    auto const [objects_per_element, objects_blocks] = measure_iteration(winrt::single_threaded_vector(std::move(objects)).GetView());
+
+    WARN("int32_t: GetAt " << integers_per_element << "us, blocks " << integers_blocks << "us");
+    WARN("hstring: GetAt " << strings_per_element << "us, blocks " << strings_blocks << "us");
+    WARN("IInspectable: GetAt " << objects_per_element << "us, blocks " << objects_blocks << "us");
+}
@@ -0,0 +1,145 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation::Collections;
+
+namespace
+{
+    std::map<int, int> make_values(int size)
+    {
+        std::map<int, int> values;
+
+        for (int i = 0; i < size; ++i)
+        {
+            values.emplace(i, i * 10);
+        }
+
+        return values;
+    }
+
+    template <typename Map>
+    std::map<int, int> visit(Map const& map)
+    {
+        std::map<int, int> result;
+
+        for_each_pair(map, [&](int const& key, int const& value)
+            {
+                REQUIRE(result.emplace(key, value).second);
+            });
+
+        return result;
+    }
+}
+
+TEST_CASE("for_each_pair")
+{
+    auto const expected = make_values(100);
+
+    // Maps from this library are visited in place.
+    IMap<int, int> single = single_threaded_map<int, int>(make_values(100));
+    REQUIRE(single.try_as<impl::IMapVisitor<int, int>>());
+    REQUIRE(visit(single) == expected);
+    REQUIRE(visit(single.GetView()) == expected);
+
+    IMap<int, int> multi = multi_threaded_map<int, int>(make_values(100));
+    REQUIRE(multi.try_as<impl::IMapVisitor<int, int>>());
+    REQUIRE(visit(multi) == expected);
+
+    IObservableMap<int, int> observable = single_threaded_observable_map<int, int>(make_values(100));
+    REQUIRE(observable.try_as<impl::IMapVisitor<int, int>>());
+    REQUIRE(visit(observable.as<IMap<int, int>>()) == expected);
+
+    IMap<int, int> unordered = single_threaded_map<int, int>(std::unordered_map<int, int>(expected.begin(), expected.end()));
+    REQUIRE(visit(unordered) == expected);
+
+    // The visitor belongs to the map that handed it out.
+    REQUIRE(single.as<impl::IMapVisitor<int, int>>().as<IMap<int, int>>() == single);
+    REQUIRE(!single.try_as<impl::IMapVisitor<int, hstring>>());
+
+    // Other maps are enumerated as usual.
+    IMapView<int, int> split;
+    IMapView<int, int> ignored;
+    single.GetView().Split(split, ignored);
+    REQUIRE(!split.try_as<impl::IMapVisitor<int, int>>());
+    REQUIRE(visit(split) == make_values(50));
+
+    // Values are passed by reference to the map's own elements.
+    IMap<hstring, hstring> strings = single_threaded_map<hstring, hstring>(std::map<hstring, hstring>{ { L"key", L"value" } });
+
+    for_each_pair(strings, [](hstring const& key, hstring const& value)
+        {
+            REQUIRE(key == L"key");
+            REQUIRE(value == L"value");
+        });
+}
+
+TEST_CASE("for_each_pair,errors")
+{
+    IMap<int, int> map = single_threaded_map<int, int>(make_values(100));
+    uint32_t count{};
+
+    // Exceptions thrown by the callback stop the visit and are rethrown as they were.
+    REQUIRE_THROWS_AS(for_each_pair(map, [&](int, int)
+        {
+            if (++count == 10)
+            {
+                throw std::out_of_range("callback");
+            }
+        }), std::out_of_range);
+
+    REQUIRE(count == 10);
+
+    // Visiting stops if the callback changes the map.
+    REQUIRE_THROWS_AS(for_each_pair(map, [&](int const& key, int)
+        {
+            map.Insert(key + 1000, 0);
+        }), hresult_changed_state);
+
+    // The callback may use a multi-threaded map, which isn't locked while it runs.
+    IMap<int, int> multi = multi_threaded_map<int, int>(make_values(100));
+    count = 0;
+
+    for_each_pair(multi, [&](int const& key, int const& value)
+        {
+            REQUIRE(multi.Lookup(key) == value);
+            ++count;
+        });
+
+    REQUIRE(count == 100);
+
+    REQUIRE_THROWS_AS(for_each_pair(multi, [&](int const& key, int)
+        {
+            multi.Insert(key + 1000, 0);
+        }), hresult_changed_state);
+
+    REQUIRE(multi.Size() == 101);
+}
+
+TEST_CASE("for_each_pair,pool")
+{
+    using pair_type = impl::key_value_pair<IKeyValuePair<int, int>>;
+
+    // Pair objects released on a thread are reused by the next pair created on that thread.
+    void* first = get_abi(make<pair_type>(1, 10));
+    void* second = get_abi(make<pair_type>(2, 20));
+    REQUIRE(first == second);
+
+    IMap<int, int> map = single_threaded_map<int, int>(make_values(1000));
+    std::vector<IKeyValuePair<int, int>> pairs(map.Size());
+    REQUIRE(map.First().GetMany(pairs) == map.Size());
+
+    for (uint32_t i = 0; i < pairs.size(); ++i)
+    {
+        REQUIRE(pairs[i].Key() == static_cast<int>(i));
+        REQUIRE(pairs[i].Value() == static_cast<int>(i * 10));
+    }
+
+    // Pairs may be released on another thread.
+    std::thread([&]
+        {
+            pairs.clear();
+        }).join();
+
+    auto pair = *map.First();
+    REQUIRE(pair.Key() == 0);
+}
@@ -0,0 +1,23 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace std::literals;
+
+TEST_CASE("hstring_concat")
+{
+    hstring const folder = L"folder";
+    std::wstring const name = L"name";
+    std::wstring_view const extension = L"txt"sv;
+
+    REQUIRE(concat(folder, L'\\', name, L".", extension) == L"folder\\name.txt");
+    REQUIRE(concat(folder) == folder);
+    REQUIRE(concat(L"a", hstring{}, L""sv, L'b') == L"ab");
+
+    REQUIRE(concat().empty());
+    REQUIRE(concat(hstring{}, L"").empty());
+
+    // The result is a single string of the combined size.
+    hstring const result = concat(folder, folder, folder);
+    REQUIRE(result.size() == folder.size() * 3);
+    REQUIRE(wcslen(result.c_str()) == result.size());
+}
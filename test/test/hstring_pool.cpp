@@ -0,0 +1,132 @@
+#include "pch.h"
+#include "benchmark.h"
+
+using namespace winrt;
+
+// The pool is only used by hstring when WINRT_HSTRING_POOL is defined, but it may be exercised
+// directly regardless.
+
+namespace
+{
+    using impl::hstring_pool;
+
+    impl::shared_hstring_header* allocate(uint32_t length)
+    {
+        auto header = hstring_pool::allocate(length);
+
+        if (!header)
+        {
+            throw std::bad_alloc();
+        }
+
+        header->length = length;
+        header->ptr = header->buffer;
+        header->count = 1;
+        std::fill_n(header->buffer, length, L'x');
+        header->buffer[length] = 0;
+        return header;
+    }
+}
+
+TEST_CASE("hstring_pool")
+{
+    for (uint32_t length = 1; length <= hstring_pool::max_length; ++length)
+    {
+        auto header = allocate(length);
+        REQUIRE(hstring_pool::free(header));
+    }
+
+    // Blocks are reused by the thread that released them.
+    auto first = allocate(10);
+    REQUIRE(hstring_pool::free(first));
+    auto second = allocate(12);
+    REQUIRE(second == first);
+    REQUIRE(hstring_pool::free(second));
+
+    // Blocks from elsewhere are reused only if they are large enough for the size class.
+    auto block = [](uint32_t length, uint32_t capacity)
+    {
+        auto header = static_cast<impl::shared_hstring_header*>(WINRT_IMPL_HeapAlloc(WINRT_IMPL_GetProcessHeap(), 0, sizeof(impl::shared_hstring_header) + sizeof(wchar_t) * capacity));
+        REQUIRE(header);
+        header->length = length;
+        return header;
+    };
+
+    auto exact = block(10, 10);
+    REQUIRE(!hstring_pool::free(exact));
+    WINRT_IMPL_HeapFree(WINRT_IMPL_GetProcessHeap(), 0, exact);
+
+    auto longer = block(hstring_pool::max_length + 1, hstring_pool::max_length + 1);
+    REQUIRE(!hstring_pool::free(longer));
+    WINRT_IMPL_HeapFree(WINRT_IMPL_GetProcessHeap(), 0, longer);
+
+    auto large = block(10, hstring_pool::class_length);
+    REQUIRE(hstring_pool::free(large));
+    REQUIRE(allocate(12) == large);
+    REQUIRE(hstring_pool::free(large));
+}
+
+TEST_CASE("hstring_pool,threads")
+{
+    // Blocks allocated on one thread are released on another. Catch assertions are not thread
+    // safe, so worker threads only count failures.
+    std::atomic<uint32_t> failures{};
+    std::vector<impl::shared_hstring_header*> headers;
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        headers.push_back(allocate(1 + i % hstring_pool::max_length));
+    }
+
+    benchmark::run_threads(4, [&](uint32_t)
+        {
+            for (uint32_t i = 0; i < 10000; ++i)
+            {
+                if (!hstring_pool::free(allocate(1 + i % hstring_pool::max_length)))
+                {
+                    ++failures;
+                }
+            }
+        });
+
+    std::thread([&]
+        {
+            for (auto&& header : headers)
+            {
+                if (wcslen(header->buffer) != header->length || !hstring_pool::free(header))
+                {
+                    ++failures;
+                }
+            }
+        }).join();
+
+    REQUIRE(failures == 0);
+}
+
+// Compares allocation throughput with the process heap.
+TEST_CASE("hstring_pool,benchmark", "[.benchmark]")
+{
+    constexpr uint32_t iterations = 100000;
+
+    for (uint32_t threads = 1; threads <= 64; threads *= 2)
+    {
+        auto const pool_time = benchmark::run_threads(threads, [](uint32_t)
+            {
+                for (uint32_t i = 0; i < iterations; ++i)
+                {
+                    hstring_pool::free(hstring_pool::allocate(1 + i % hstring_pool::max_length));
+                }
+            });
+
+        auto const heap_time = benchmark::run_threads(threads, [](uint32_t)
+            {
+                for (uint32_t i = 0; i < iterations; ++i)
+                {
+                    auto const bytes = sizeof(impl::shared_hstring_header) + sizeof(wchar_t) * (1 + i % hstring_pool::max_length);
+                    WINRT_IMPL_HeapFree(WINRT_IMPL_GetProcessHeap(), 0, WINRT_IMPL_HeapAlloc(WINRT_IMPL_GetProcessHeap(), 0, bytes));
+                }
+            });
+
+        WARN(threads << " threads: pool " << pool_time << "us, heap " << heap_time << "us");
+    }
+}
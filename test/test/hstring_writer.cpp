@@ -0,0 +1,82 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace std::literals;
+
+namespace
+{
+    template <typename T, typename = void>
+    struct can_append : std::false_type {};
+
+    template <typename T>
+    struct can_append<T, std::void_t<decltype(std::declval<hstring_writer&>().append(std::declval<T>()))>> : std::true_type {};
+}
+
+TEST_CASE("hstring_writer")
+{
+    hstring_writer writer;
+    REQUIRE(writer.empty());
+    REQUIRE(writer.to_hstring().empty());
+
+    writer.append(L"count=").append(42).append(L',').append(-7ll).append(L',').append(1.5).append(L',').append(true);
+    writer += L"!"sv;
+    REQUIRE(std::wstring_view(writer) == L"count=42,-7,1.5,true!"sv);
+
+    hstring const result = writer.to_hstring();
+    REQUIRE(result == L"count=42,-7,1.5,true!");
+    REQUIRE(wcslen(result.c_str()) == result.size());
+    REQUIRE(writer.empty());
+    REQUIRE(writer.capacity() == 0);
+
+    writer.append(guid{ 0x12345678, 0x1234, 0x5678, { 1, 2, 3, 4, 5, 6, 7, 8 } });
+    REQUIRE(writer.to_hstring() == L"{12345678-1234-5678-0102-030405060708}");
+}
+
+TEST_CASE("hstring_writer,growth")
+{
+    hstring_writer writer;
+    std::wstring expected;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        writer.append(i).append(L' ');
+        expected += std::to_wstring(i) + L' ';
+    }
+
+    REQUIRE(writer.capacity() >= writer.size());
+    writer.shrink_to_fit();
+    REQUIRE(writer.capacity() == writer.size());
+
+    // The storage is handed to the hstring rather than copied.
+    wchar_t const* data = writer.data();
+    hstring const result = writer.to_hstring();
+    REQUIRE(result.data() == data);
+    REQUIRE(result == expected);
+}
+
+TEST_CASE("hstring_writer,in_place")
+{
+    hstring_writer writer(8);
+    REQUIRE(writer.capacity() == 8);
+
+    writer.resize(3);
+    std::fill_n(writer.data(), 3, L'x');
+    std::copy_n(L"yz", 2, std::back_inserter(writer));
+    REQUIRE(writer.to_hstring() == L"xxxyz");
+}
+
+TEST_CASE("hstring_writer,formatting")
+{
+    // Numbers and guids are formatted as by to_hstring.
+    hstring_writer writer;
+    writer.append(uint8_t{ 255 }).append(L' ').append(0.1f).append(L' ').append(UINT64_MAX);
+    REQUIRE(writer.to_hstring() == to_hstring(uint8_t{ 255 }) + L" " + to_hstring(0.1f) + L" " + to_hstring(UINT64_MAX));
+
+    guid const value{ 0x12345678, 0x1234, 0x5678, { 1, 2, 3, 4, 5, 6, 7, 8 } };
+    writer.append(value);
+    REQUIRE(writer.to_hstring() == to_hstring(value));
+
+    // A char could be either a wchar_t or a char16_t.
+    STATIC_REQUIRE(!can_append<char>::value);
+    STATIC_REQUIRE(can_append<wchar_t>::value);
+}
@@ -0,0 +1,159 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation::Collections;
+
+namespace
+{
+    IMap<int, int> make_map(int size)
+    {
+        std::map<int, int> values;
+
+        for (int i = 0; i < size; ++i)
+        {
+            values.emplace(i, i * 10);
+        }
+
+        return single_threaded_map<int, int>(std::move(values));
+    }
+
+    std::vector<int> keys(IMapView<int, int> const& view)
+    {
+        std::vector<int> result;
+
+        for (auto&& pair : view)
+        {
+            result.push_back(pair.Key());
+        }
+
+        return result;
+    }
+
+    // Splits the view until no part can be split any further and returns the parts in order.
+    void split_all(IMapView<int, int> const& view, std::vector<IMapView<int, int>>& parts)
+    {
+        IMapView<int, int> first;
+        IMapView<int, int> second;
+        view.Split(first, second);
+
+        if (!first)
+        {
+            REQUIRE(!second);
+            parts.push_back(view);
+            return;
+        }
+
+        REQUIRE(first.Size() + second.Size() == view.Size());
+        split_all(first, parts);
+        split_all(second, parts);
+    }
+}
+
+TEST_CASE("map_split")
+{
+    auto map = make_map(10);
+    IMapView<int, int> first;
+    IMapView<int, int> second;
+    map.GetView().Split(first, second);
+
+    // Ordered maps are split into adjacent halves.
+    REQUIRE(first.Size() == 5);
+    REQUIRE(second.Size() == 5);
+    REQUIRE(keys(first) == std::vector<int>{ 0, 1, 2, 3, 4 });
+    REQUIRE(keys(second) == std::vector<int>{ 5, 6, 7, 8, 9 });
+
+    // Lookups are limited to the range covered by each half.
+    REQUIRE(first.Lookup(4) == 40);
+    REQUIRE(first.HasKey(0));
+    REQUIRE(!first.HasKey(5));
+    REQUIRE_THROWS_AS(first.Lookup(5), hresult_out_of_bounds);
+    REQUIRE(second.Lookup(5) == 50);
+    REQUIRE(second.HasKey(9));
+    REQUIRE(!second.HasKey(4));
+    REQUIRE(!second.HasKey(10));
+    REQUIRE(!second.TryLookup(4));
+
+    // Every element is in exactly one part once the map can no longer be split.
+    std::vector<IMapView<int, int>> parts;
+    split_all(make_map(37).GetView(), parts);
+    REQUIRE(parts.size() == 37);
+
+    for (int i = 0; i < 37; ++i)
+    {
+        REQUIRE(parts[i].Size() == 1);
+        REQUIRE(parts[i].Lookup(i) == i * 10);
+        REQUIRE(keys(parts[i]) == std::vector<int>{ i });
+    }
+
+    // Maps with fewer than two elements cannot be split.
+    make_map(1).GetView().Split(first, second);
+    REQUIRE(!first);
+    REQUIRE(!second);
+    make_map(0).GetView().Split(first, second);
+    REQUIRE(!first);
+    REQUIRE(!second);
+
+    // Neither can unordered maps.
+    IMap<int, int> unordered = single_threaded_map<int, int>(std::unordered_map<int, int>{ { 1, 10 }, { 2, 20 }, { 3, 30 } });
+    unordered.GetView().Split(first, second);
+    REQUIRE(!first);
+    REQUIRE(!second);
+}
+
+TEST_CASE("map_split,changed")
+{
+    auto map = make_map(10);
+    IMapView<int, int> first;
+    IMapView<int, int> second;
+    map.GetView().Split(first, second);
+    auto iterator = first.First();
+
+    // The halves share the version of the map they came from.
+    map.Insert(10, 100);
+    REQUIRE_THROWS_AS(first.Size(), hresult_changed_state);
+    REQUIRE_THROWS_AS(second.Lookup(5), hresult_changed_state);
+    REQUIRE_THROWS_AS(iterator.Current(), hresult_changed_state);
+    REQUIRE_THROWS_AS(first.Split(first, second), hresult_changed_state);
+}
+
+TEST_CASE("map_split,parallel_for_each")
+{
+    constexpr int size = 100000;
+
+    for (auto&& map : { make_map(size), multi_threaded_map<int, int>(), single_threaded_map<int, int>(std::unordered_map<int, int>{}) })
+    {
+        if (map.Size() == 0)
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                map.Insert(i, i * 10);
+            }
+        }
+
+        // Catch assertions are not thread safe, so the callback only records what it sees.
+        std::vector<std::atomic<uint32_t>> visits(size);
+        std::atomic<uint32_t> failures{};
+
+        parallel_for_each(map, [&](IKeyValuePair<int, int> const& pair)
+            {
+                if (pair.Value() != pair.Key() * 10)
+                {
+                    ++failures;
+                }
+
+                ++visits[pair.Key()];
+            }, 100);
+
+        REQUIRE(failures == 0);
+        REQUIRE(std::all_of(visits.begin(), visits.end(), [](auto&& count) { return count == 1; }));
+    }
+
+    // The first exception is rethrown once the remaining work has finished.
+    REQUIRE_THROWS_AS(parallel_for_each(make_map(size), [](IKeyValuePair<int, int> const& pair)
+        {
+            if (pair.Key() == size / 3)
+            {
+                throw hresult_invalid_argument();
+            }
+        }, 100), hresult_invalid_argument);
+}
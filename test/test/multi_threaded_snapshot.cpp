@@ -0,0 +1,197 @@
+#include "pch.h"
+#include "benchmark.h"
+
+using namespace winrt;
+using namespace Windows::Foundation::Collections;
+
+namespace
+{
+    std::map<int, int> make_values(int size)
+    {
+        std::map<int, int> values;
+
+        for (int i = 0; i < size; ++i)
+        {
+            values.emplace(i, i * 10);
+        }
+
+        return values;
+    }
+}
+
+TEST_CASE("multi_threaded_snapshot_vector")
+{
+    IVector<int> vector = multi_threaded_snapshot_vector<int>({ 1, 2, 3 });
+    REQUIRE(vector.Size() == 3);
+    REQUIRE(vector.GetAt(2) == 3);
+    REQUIRE_THROWS_AS(vector.GetAt(3), hresult_out_of_bounds);
+
+    vector.Append(4);
+    vector.InsertAt(0, 0);
+    vector.SetAt(1, 10);
+    REQUIRE(vector.GetView().Size() == 5);
+
+    uint32_t index{};
+    REQUIRE(vector.IndexOf(10, index));
+    REQUIRE(index == 1);
+
+    std::array<int, 10> values{};
+    REQUIRE(vector.GetMany(1, values) == 4);
+    REQUIRE(values[0] == 10);
+    REQUIRE(values[3] == 4);
+
+    // Failed changes leave the vector as it was.
+    REQUIRE_THROWS_AS(vector.SetAt(5, 0), hresult_out_of_bounds);
+    REQUIRE_THROWS_AS(vector.InsertAt(6, 0), hresult_out_of_bounds);
+    REQUIRE_THROWS_AS(vector.RemoveAt(5), hresult_out_of_bounds);
+    REQUIRE(vector.Size() == 5);
+
+    // Iterators keep the vector as it was when they were created.
+    auto iterator = vector.First();
+    vector.RemoveAt(0);
+    vector.RemoveAtEnd();
+    REQUIRE(vector.Size() == 3);
+    REQUIRE(iterator.Current() == 0);
+    REQUIRE(iterator.GetMany(values) == 5);
+    REQUIRE(values[4] == 4);
+    REQUIRE(!iterator.HasCurrent());
+
+    vector.ReplaceAll({ 7, 8 });
+    REQUIRE(vector.GetAt(1) == 8);
+    vector.Clear();
+    REQUIRE(vector.Size() == 0);
+    REQUIRE_THROWS_AS(vector.RemoveAtEnd(), hresult_out_of_bounds);
+}
+
+TEST_CASE("multi_threaded_snapshot_map")
+{
+    IMap<int, int> map = multi_threaded_snapshot_map<int, int>(make_values(10));
+    REQUIRE(map.Size() == 10);
+    REQUIRE(map.Lookup(9) == 90);
+    REQUIRE(map.HasKey(0));
+    REQUIRE_THROWS_AS(map.Lookup(10), hresult_out_of_bounds);
+
+    REQUIRE(!map.Insert(10, 100));
+    REQUIRE(map.Insert(10, 1000));
+    REQUIRE(map.GetView().Lookup(10) == 1000);
+    REQUIRE_THROWS_AS(map.Remove(11), hresult_out_of_bounds);
+    REQUIRE(map.Size() == 11);
+
+    // Iterators and the halves of a split keep the map as it was when they were created.
+    auto iterator = map.First();
+    IMapView<int, int> first;
+    IMapView<int, int> second;
+    map.GetView().Split(first, second);
+    map.Remove(0);
+    map.Clear();
+    REQUIRE(map.Size() == 0);
+    REQUIRE(iterator.Current().Key() == 0);
+    REQUIRE(first.Size() + second.Size() == 11);
+    REQUIRE(first.Lookup(0) == 0);
+
+    int count{};
+
+    for (; iterator.HasCurrent(); iterator.MoveNext())
+    {
+        ++count;
+    }
+
+    REQUIRE(count == 11);
+
+    IMap<int, int> unordered = multi_threaded_snapshot_map<int, int>(std::unordered_map<int, int>{ { 1, 10 } });
+    REQUIRE(unordered.Lookup(1) == 10);
+    unordered.Remove(1);
+    REQUIRE(!unordered.HasKey(1));
+
+    // Replaced values are released once no reader can see them.
+    IMap<int, IVector<int>> vectors = multi_threaded_snapshot_map<int, IVector<int>>();
+    vectors.Insert(1, single_threaded_vector<int>());
+    auto weak = make_weak(vectors.Lookup(1));
+    vectors.Remove(1);
+    REQUIRE(!weak.get());
+}
+
+TEST_CASE("multi_threaded_snapshot_map,threads")
+{
+    // Writers only ever insert a key with its value, so readers must always find both together.
+    // Catch assertions are not thread safe, so worker threads only count failures.
+    IMap<int, int> map = multi_threaded_snapshot_map<int, int>(make_values(100));
+    std::atomic<uint32_t> failures{};
+    std::atomic<uint32_t> writers{ 2 };
+
+    benchmark::run_threads(6, [&](uint32_t const thread)
+        {
+            if (thread < 2)
+            {
+                for (int i = 0; i < 500; ++i)
+                {
+                    int const key = 100 + i * 2 + static_cast<int>(thread);
+                    map.Insert(key, key * 10);
+                }
+
+                --writers;
+                return;
+            }
+
+            while (writers != 0)
+            {
+                uint32_t const size = map.Size();
+                int expected{};
+
+                for (auto&& pair : map)
+                {
+                    if (pair.Value() != pair.Key() * 10)
+                    {
+                        ++failures;
+                    }
+
+                    ++expected;
+                }
+
+                if (expected < static_cast<int>(size) || map.Lookup(99) != 990)
+                {
+                    ++failures;
+                }
+            }
+        });
+
+    REQUIRE(failures == 0);
+    REQUIRE(map.Size() == 1100);
+}
+
+// Compares the snapshot map with the locking map as the number of readers grows, both with readers
+// only and with one of the threads writing.
+TEST_CASE("multi_threaded_snapshot_map,benchmark", "[.benchmark]")
+{
+    constexpr int size = 1000;
+    constexpr uint32_t iterations = 100000;
+
+    auto measure = [](IMap<int, int> const& map, uint32_t const threads, bool const write)
+    {
+        return benchmark::run_threads(threads, [&](uint32_t const thread)
+            {
+                for (uint32_t i = 0; i < iterations; ++i)
+                {
+                    int const key = static_cast<int>(i % size);
+
+                    if (write && thread == 0 && i % 1000 == 0)
+                    {
+                        map.Insert(key, key * 10);
+                    }
+                    else
+                    {
+                        map.Lookup(key);
+                    }
+                }
+            });
+    };
+
+    for (uint32_t threads = 1; threads <= 64; threads *= 2)
+    {
+        IMap<int, int> locking = multi_threaded_map<int, int>(make_values(size));
+        IMap<int, int> snapshot = multi_threaded_snapshot_map<int, int>(make_values(size));
+
+        WARN(threads << " threads: readers only, locking " << measure(locking, threads, false) << "us, snapshot " << measure(snapshot, threads, false)
+            << "us; with a writer, locking " << measure(locking, threads, true) << "us, snapshot " << measure(snapshot, threads, true) << "us");
+    }
+}
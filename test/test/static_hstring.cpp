@@ -0,0 +1,43 @@
+#include "pch.h"
+
+using namespace std::literals;
+
+namespace
+{
+    winrt::static_hstring name{ L"Name" };
+    winrt::static_hstring empty{ L"" };
+
+    winrt::hstring get_name()
+    {
+        return name;
+    }
+}
+
+TEST_CASE("static_hstring")
+{
+    winrt::hstring a = get_name();
+    REQUIRE(a == L"Name"sv);
+    REQUIRE(a.size() == 4);
+    REQUIRE(wcslen(a.c_str()) == 4);
+
+    // Copies share the static buffer rather than allocating.
+    winrt::hstring b = a;
+    REQUIRE(b.data() == a.data());
+    REQUIRE(get_abi(b) == get_abi(a));
+
+    winrt::hstring c;
+    c = b;
+    REQUIRE(c.data() == a.data());
+
+    // Duplicating and deleting through the ABI leaves the string intact.
+    HSTRING duplicate{};
+    REQUIRE(S_OK == WindowsDuplicateString(static_cast<HSTRING>(get_abi(a)), &duplicate));
+    REQUIRE(S_OK == WindowsDeleteString(duplicate));
+    REQUIRE(get_name() == L"Name"sv);
+
+    std::wstring_view view = name;
+    REQUIRE(view == L"Name"sv);
+
+    winrt::hstring none = empty;
+    REQUIRE(none.empty());
+}
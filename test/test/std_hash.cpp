@@ -0,0 +1,40 @@
+#include "pch.h"
+
+#include <set>
+
+using namespace winrt;
+
+TEST_CASE("std_hash")
+{
+    // Equal keys hash equally regardless of where the string came from.
+    hstring const hello = L"hello world";
+    REQUIRE(std::hash<hstring>{}(hello) == std::hash<hstring>{}(hstring{ std::wstring(L"hello world") }));
+    REQUIRE(std::hash<hstring>{}(hstring{}) == std::hash<hstring>{}(hstring{ L"" }));
+
+    // Strings hash as their views do, so containers can look up hstring keys by view.
+    REQUIRE(std::hash<hstring>{}(hello) == std::hash<std::wstring_view>{}(L"hello world"));
+
+    guid const first{ 0x12345678, 0x1234, 0x5678, { 1, 2, 3, 4, 5, 6, 7, 8 } };
+    guid const copy = first;
+    REQUIRE(std::hash<guid>{}(first) == std::hash<guid>{}(copy));
+
+    // Keys that differ in a single bit, in any position, produce distinct hashes.
+    std::set<size_t> hashes;
+    hashes.insert(std::hash<guid>{}(first));
+
+    for (size_t bit = 0; bit < sizeof(guid) * 8; ++bit)
+    {
+        guid value = first;
+        reinterpret_cast<uint8_t*>(&value)[bit / 8] ^= static_cast<uint8_t>(1 << (bit % 8));
+        hashes.insert(std::hash<guid>{}(value));
+    }
+
+    REQUIRE(hashes.size() == sizeof(guid) * 8 + 1);
+
+    // Strings that differ only in length or in their last character.
+    REQUIRE(std::hash<hstring>{}(L"a") != std::hash<hstring>{}(L"aa"));
+    REQUIRE(std::hash<hstring>{}(L"abcdefgh") != std::hash<hstring>{}(L"abcdefgi"));
+
+    std::unordered_map<guid, int> map{ { first, 1 } };
+    REQUIRE(map[copy] == 1);
+}
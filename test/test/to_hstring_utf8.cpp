@@ -0,0 +1,119 @@
+#include "pch.h"
+#include "benchmark.h"
+
+using namespace winrt;
+using namespace std::literals;
+
+namespace
+{
+    struct sample
+    {
+        std::string_view utf8;
+        std::wstring_view utf16;
+    };
+
+    constexpr sample samples[]
+    {
+        { ""sv, L""sv },
+        { "value"sv, L"value"sv },
+        { "The quick brown fox jumps over the lazy dog"sv, L"The quick brown fox jumps over the lazy dog"sv },
+        { "caf\xc3\xa9 na\xc3\xafve r\xc3\xa9sum\xc3\xa9"sv, L"caf\u00e9 na\u00efve r\u00e9sum\u00e9"sv },
+        { "12345678\xc3\xa9"sv, L"12345678\u00e9"sv },
+        { "\xe4\xbd\xa0\xe5\xa5\xbd\xe4\xb8\x96\xe7\x95\x8c"sv, L"\u4f60\u597d\u4e16\u754c"sv },
+        { "emoji \xf0\x9f\x98\x80 end"sv, L"emoji \U0001F600 end"sv },
+    };
+
+    // The conversions as they were before the ASCII fast path, for comparison.
+    hstring to_hstring_two_pass(std::string_view const& value)
+    {
+        int const size = MultiByteToWideChar(CP_UTF8, 0, value.data(), static_cast<int>(value.size()), nullptr, 0);
+        std::wstring result(size, L'?');
+        MultiByteToWideChar(CP_UTF8, 0, value.data(), static_cast<int>(value.size()), result.data(), size);
+        return hstring{ result };
+    }
+
+    std::string to_string_two_pass(std::wstring_view const& value)
+    {
+        int const size = WideCharToMultiByte(CP_UTF8, 0, value.data(), static_cast<int>(value.size()), nullptr, 0, nullptr, nullptr);
+        std::string result(size, '?');
+        WideCharToMultiByte(CP_UTF8, 0, value.data(), static_cast<int>(value.size()), result.data(), size, nullptr, nullptr);
+        return result;
+    }
+
+    std::string repeat(std::string_view const& value, size_t count)
+    {
+        std::string result;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            result += value;
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("to_hstring_utf8")
+{
+    for (auto&& [utf8, utf16] : samples)
+    {
+        hstring converted = to_hstring(utf8);
+        REQUIRE(converted == utf16);
+        REQUIRE(wcslen(converted.c_str()) == converted.size());
+        REQUIRE(to_string(utf16) == utf8);
+    }
+
+    // Non-ASCII characters at every offset relative to the words that are tested at once.
+    for (size_t prefix = 0; prefix < 16; ++prefix)
+    {
+        std::string utf8 = std::string(prefix, 'a') + "\xc3\xa9" + "bcdefghijk";
+        std::wstring utf16 = std::wstring(prefix, L'a') + L"\u00e9" + L"bcdefghijk";
+        REQUIRE(to_hstring(utf8) == utf16);
+        REQUIRE(to_string(utf16) == utf8);
+    }
+
+    // Invalid sequences are replaced just as the system does.
+    std::string_view invalid = "bad \xff\xfe bytes"sv;
+    REQUIRE(to_hstring(invalid) == to_hstring_two_pass(invalid));
+    std::wstring_view unpaired = L"lone \xd800 surrogate"sv;
+    REQUIRE(to_string(unpaired) == to_string_two_pass(unpaired));
+}
+
+// Compares with converting through the system in two passes.
+TEST_CASE("to_hstring_utf8,benchmark", "[.benchmark]")
+{
+    std::pair<char const*, std::string> const corpora[]
+    {
+        { "ascii", repeat("The quick brown fox jumps over the lazy dog. ", 40) },
+        { "latin", repeat("Le c\xc5\x93ur d\xc3\xa9\xc3\xa7u mais l'\xc3\xa2me in\xc3\xa9puis\xc3\xa9\x65. ", 40) },
+        { "cjk", repeat("\xe4\xbd\xa0\xe5\xa5\xbd\xe4\xb8\x96\xe7\x95\x8c\xe3\x81\x93\xe3\x82\x93\xe3\x81\xab\xe3\x81\xa1\xe3\x81\xaf", 80) },
+        { "emoji", repeat("\xf0\x9f\x98\x80\xf0\x9f\x8e\x89\xf0\x9f\x9a\x80 ok ", 80) },
+    };
+
+    constexpr uint32_t iterations = 20000;
+
+    auto measure = [](auto&& callback)
+    {
+        return benchmark::measure([&]
+            {
+                for (uint32_t i = 0; i < iterations; ++i)
+                {
+                    callback();
+                }
+            });
+    };
+
+    for (auto&& [name, utf8] : corpora)
+    {
+        hstring const utf16 = to_hstring(utf8);
+        REQUIRE(utf16 == to_hstring_two_pass(utf8));
+
+        auto const to_hstring_time = measure([&] { to_hstring(utf8); });
+        auto const to_hstring_two_pass_time = measure([&] { to_hstring_two_pass(utf8); });
+        auto const to_string_time = measure([&] { to_string(utf16); });
+        auto const to_string_two_pass_time = measure([&] { to_string_two_pass(utf16); });
+
+        WARN(name << ": to_hstring " << to_hstring_time << "us (two pass " << to_hstring_two_pass_time
+            << "us), to_string " << to_string_time << "us (two pass " << to_string_two_pass_time << "us)");
+    }
+}
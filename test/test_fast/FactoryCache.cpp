@@ -0,0 +1,38 @@
+#include "pch.h"
+#include "winrt/test_component_fast.h"
+
+using namespace winrt;
+using namespace test_component_fast;
+
+TEST_CASE("FactoryCache")
+{
+    clear_factory_cache();
+    impl::get_diagnostics_info().detach();
+
+    // The factory is resolved on the thread pool and is already cached by the time the class
+    // is first activated on this thread.
+    prewarm_factories<Simple>();
+    auto& entry = impl::factory_cache_entry_v<Simple, Windows::Foundation::IActivationFactory>;
+
+    for (uint32_t i = 0; i < 5000 && !impl::interlocked_read_pointer(&entry.m_value.object); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    REQUIRE(impl::interlocked_read_pointer(&entry.m_value.object));
+
+    Simple first;
+    Simple second;
+    REQUIRE(first.Method1() == L"Method1");
+
+    auto info = impl::get_diagnostics_info().detach();
+    REQUIRE(info.factories[name_of<Simple>()].requests == 1);
+    REQUIRE(info.factories[name_of<Simple>()].hits == 2);
+    REQUIRE(info.factories[name_of<Simple>()].contention == 0);
+
+    // Detaching resets the counters.
+    info = impl::get_diagnostics_info().get();
+    REQUIRE(info.factories.empty());
+
+    clear_factory_cache();
+}